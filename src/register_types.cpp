@@ -1,15 +1,20 @@
 // MIT License
 // Copyright (c) 2025 Lucas "Shoyguer" Melo
 
+#include "time_calendar.hpp"
 #include "time_tick.hpp"
+#include "time_tick_hub.hpp"
+#include "time_tick_server.hpp"
 
 #include <gdextension_interface.h>
+#include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/core/defs.hpp>
 #include <godot_cpp/godot.hpp>
 
 using namespace godot;
 
+static TimeTickServer *time_tick_server = nullptr;
 
 void initialize_gdextension_types(ModuleInitializationLevel p_level)
 {
@@ -17,13 +22,27 @@ void initialize_gdextension_types(ModuleInitializationLevel p_level)
 		return;
 	}
 
+	GDREGISTER_CLASS(TimeCalendar)
 	GDREGISTER_CLASS(TimeTick)
+	// Abstract so scripts can't instantiate a second server, the singleton is the only instance
+	GDREGISTER_ABSTRACT_CLASS(TimeTickServer)
+
+	time_tick_server = memnew(TimeTickServer);
+	TimeTickServer::set_singleton(time_tick_server);
+	Engine::get_singleton()->register_singleton("TimeTickServer", time_tick_server);
 }
 
 void uninitialize_gdextension_types(ModuleInitializationLevel p_level) {
 	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
 		return;
 	}
+
+	TimeTickHub::cleanup();
+
+	Engine::get_singleton()->unregister_singleton("TimeTickServer");
+	TimeTickServer::set_singleton(nullptr);
+	memdelete(time_tick_server);
+	time_tick_server = nullptr;
 }
 
 extern "C"
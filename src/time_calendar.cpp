@@ -0,0 +1,208 @@
+// MIT License
+// Copyright (c) 2025 Lucas "Shoyguer" Melo
+
+#include "time_calendar.hpp"
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+using namespace godot;
+
+
+// Adds a simple unit (same parameters as TimeTick.register_time_unit)
+void TimeCalendar::add_unit(const StringName &unit_name, const StringName &tracked_unit, int trigger_count, int max_value, int min_value) {
+	if (!_check_editable()) {
+		return;
+	}
+
+	Dictionary unit;
+	unit["name"] = unit_name;
+	unit["tracked_unit"] = tracked_unit;
+	unit["trigger_count"] = trigger_count;
+	unit["max_value"] = max_value;
+	unit["min_value"] = min_value;
+	if (_add_unit(unit)) {
+		emit_changed();
+	}
+}
+
+// Adds a complex unit (same parameters as TimeTick.register_complex_time_unit)
+void TimeCalendar::add_complex_unit(const StringName &unit_name, const Dictionary &tracked_units, int max_value, int min_value) {
+	if (!_check_editable()) {
+		return;
+	}
+
+	Dictionary unit;
+	unit["name"] = unit_name;
+	unit["tracked_units"] = tracked_units.duplicate();
+	unit["max_value"] = max_value;
+	unit["min_value"] = min_value;
+	if (_add_unit(unit)) {
+		emit_changed();
+	}
+}
+
+// Sets how much a unit increases each time it triggers
+void TimeCalendar::set_unit_step(const StringName &unit_name, int step_amount) {
+	if (!_check_editable()) {
+		return;
+	}
+
+	if (!definition.has_unit(unit_name)) {
+		UtilityFunctions::push_error(vformat("TimeCalendar: Time unit '%s' not found", unit_name));
+		return;
+	}
+	definition.set_step(unit_name, step_amount);
+
+	for (int i = 0; i < units.size(); i++) {
+		Dictionary unit = units[i];
+		if (StringName(unit["name"]) == unit_name) {
+			unit["step_amount"] = step_amount;
+		}
+	}
+	emit_changed();
+}
+
+// Removes every unit
+void TimeCalendar::clear() {
+	if (!_check_editable()) {
+		return;
+	}
+
+	definition.clear();
+	units.clear();
+	emit_changed();
+}
+
+// Returns true if the unit exists in this calendar
+bool TimeCalendar::has_unit(const StringName &unit_name) const {
+	return definition.has_unit(unit_name);
+}
+
+// Returns the id of a unit, the same on every TimeTick using this calendar, or -1 if the unit doesn't exist
+int TimeCalendar::get_unit_id(const StringName &unit_name) const {
+	return definition.find_unit_id(unit_name);
+}
+
+// Returns the names of every unit, in registration order
+TypedArray<String> TimeCalendar::get_unit_names() const {
+	return definition.get_all_names();
+}
+
+// Returns true while a TimeTick uses this calendar, it can't be changed until then
+bool TimeCalendar::is_in_use() const {
+	return user_count > 0;
+}
+
+// Replaces the hierarchy with a list of unit dictionaries, in registration order
+// Entries that fail validation are reported and skipped
+void TimeCalendar::set_units(const Array &p_units) {
+	if (!_check_editable()) {
+		return;
+	}
+
+	definition.clear();
+	units.clear();
+	for (int i = 0; i < p_units.size(); i++) {
+		if (p_units[i].get_type() != Variant::DICTIONARY) {
+			UtilityFunctions::push_error(vformat("TimeCalendar: Unit entry %d is not a Dictionary", i));
+			continue;
+		}
+		_add_unit(p_units[i]);
+	}
+	emit_changed();
+}
+
+// Returns a copy of the unit dictionaries, in registration order
+Array TimeCalendar::get_units() const {
+	return units.duplicate(true);
+}
+
+// Reports an error and returns false while TimeTicks use this calendar
+bool TimeCalendar::_check_editable() const {
+	if (user_count > 0) {
+		UtilityFunctions::push_error("TimeCalendar: Cannot change a calendar while a TimeTick uses it");
+		return false;
+	}
+	return true;
+}
+
+// Validates and registers one unit dictionary, then stores a normalized copy of it
+// A unit registered again replaces its previous entry
+bool TimeCalendar::_add_unit(const Dictionary &unit) {
+	StringName unit_name = unit.get("name", StringName());
+	if (unit_name == StringName()) {
+		UtilityFunctions::push_error("TimeCalendar: Unit name cannot be empty");
+		return false;
+	}
+
+	int max_value = unit.get("max_value", -1);
+	int min_value = unit.get("min_value", 0);
+	int step_amount = unit.get("step_amount", 1);
+
+	Dictionary stored;
+	stored["name"] = unit_name;
+	if (unit.has("tracked_units")) {
+		Dictionary tracked_units = unit["tracked_units"];
+		if (tracked_units.is_empty()) {
+			UtilityFunctions::push_error("TimeCalendar: Complex time unit must track at least one unit");
+			return false;
+		}
+
+		if (definition.would_create_cycle(unit_name, tracked_units)) {
+			UtilityFunctions::push_error(vformat("TimeCalendar: Cannot add complex unit '%s', its tracked units would create a dependency cycle", unit_name));
+			return false;
+		}
+
+		definition.register_complex_unit(unit_name, tracked_units, max_value, min_value);
+		stored["tracked_units"] = tracked_units;
+	} else {
+		StringName tracked_unit = unit.get("tracked_unit", StringName("tick"));
+		int trigger_count = unit.get("trigger_count", 1);
+		if (trigger_count <= 0) {
+			UtilityFunctions::push_error("TimeCalendar: Trigger count must be positive");
+			return false;
+		}
+
+		if (definition.would_create_cycle(unit_name, tracked_unit)) {
+			UtilityFunctions::push_error(vformat("TimeCalendar: Cannot add '%s' tracking '%s', it would create a dependency cycle", unit_name, tracked_unit));
+			return false;
+		}
+
+		definition.register_simple_unit(unit_name, tracked_unit, trigger_count, max_value, min_value);
+		stored["tracked_unit"] = tracked_unit;
+		stored["trigger_count"] = trigger_count;
+	}
+
+	if (step_amount != 1) {
+		definition.set_step(unit_name, step_amount);
+	}
+	stored["step_amount"] = step_amount;
+	stored["max_value"] = max_value;
+	stored["min_value"] = min_value;
+
+	for (int i = 0; i < units.size(); i++) {
+		Dictionary existing = units[i];
+		if (StringName(existing["name"]) == unit_name) {
+			units[i] = stored;
+			return true;
+		}
+	}
+	units.push_back(stored);
+	return true;
+}
+
+// Registers all methods and properties with Godot's ClassDB
+void TimeCalendar::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("add_unit", "unit_name", "tracked_unit", "trigger_count", "max_value", "min_value"), &TimeCalendar::add_unit, DEFVAL(1), DEFVAL(-1), DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("add_complex_unit", "unit_name", "tracked_units", "max_value", "min_value"), &TimeCalendar::add_complex_unit, DEFVAL(-1), DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("set_unit_step", "unit_name", "step_amount"), &TimeCalendar::set_unit_step);
+	ClassDB::bind_method(D_METHOD("clear"), &TimeCalendar::clear);
+	ClassDB::bind_method(D_METHOD("has_unit", "unit_name"), &TimeCalendar::has_unit);
+	ClassDB::bind_method(D_METHOD("get_unit_id", "unit_name"), &TimeCalendar::get_unit_id);
+	ClassDB::bind_method(D_METHOD("get_unit_names"), &TimeCalendar::get_unit_names);
+	ClassDB::bind_method(D_METHOD("is_in_use"), &TimeCalendar::is_in_use);
+	ClassDB::bind_method(D_METHOD("set_units", "units"), &TimeCalendar::set_units);
+	ClassDB::bind_method(D_METHOD("get_units"), &TimeCalendar::get_units);
+
+	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "units"), "set_units", "get_units");
+}
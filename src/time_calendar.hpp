@@ -0,0 +1,62 @@
+// MIT License
+// Copyright (c) 2025 Lucas "Shoyguer" Melo
+
+#pragma once
+
+#include <godot_cpp/classes/resource.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
+
+// Helper classes
+#include "time_unit_manager.hpp"
+
+using namespace godot;
+
+// Reusable unit hierarchy, compiled once and shared by every TimeTick using it
+//
+// The calendar owns the unit table (names, tracking, steps, limits and the compiled
+// cascade plan). A TimeTick set to a calendar only keeps its own values, counters,
+// trigger latches and listeners. The hierarchy is saved as the "units" property,
+// one dictionary per unit in registration order.
+class TimeCalendar : public Resource {
+	GDCLASS(TimeCalendar, Resource)
+
+public:
+	TimeCalendar() = default;
+	~TimeCalendar() = default;
+
+	// Unit definition
+	void add_unit(const StringName &unit_name, const StringName &tracked_unit, int trigger_count = 1, int max_value = -1, int min_value = 0);
+	void add_complex_unit(const StringName &unit_name, const Dictionary &tracked_units, int max_value = -1, int min_value = 0);
+	void set_unit_step(const StringName &unit_name, int step_amount);
+	void clear();
+
+	// Queries
+	bool has_unit(const StringName &unit_name) const;
+	int get_unit_id(const StringName &unit_name) const;
+	TypedArray<String> get_unit_names() const;
+	bool is_in_use() const;
+
+	// Serialized hierarchy
+	void set_units(const Array &p_units);
+	Array get_units() const;
+
+	// Used by TimeTick, not exposed to Godot
+	TimeUnitManager *get_definition() { return &definition; }
+	void add_user() { user_count++; }
+	void remove_user() { user_count--; }
+
+protected:
+	static void _bind_methods();
+
+private:
+	TimeUnitManager definition;
+	// One dictionary per unit, in registration order
+	Array units;
+	// TimeTicks currently using this calendar, it can't be changed while this is above 0
+	int user_count = 0;
+
+	bool _check_editable() const;
+	bool _add_unit(const Dictionary &unit);
+};
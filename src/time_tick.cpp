@@ -22,44 +22,46 @@ TimeTick::~TimeTick() {
 	}
 }
 
-// Initializes the time system with specified tick duration and connects to physics frame
+// Initializes the time system with specified tick duration and connects to the frame signal of the driver mode
 void TimeTick::initialize(double tick_duration) {
 	if (tick_duration <= 0.0) {
 		UtilityFunctions::push_warning("TimeTick: Tick duration must be greater than 0.0, clamping to 0.001");
 		tick_duration = 0.001;
 	}
-	tick_time = CLAMP(tick_duration, 0.001, 600.0);
+	tick_nsec = _seconds_to_nsec(CLAMP(tick_duration, 0.001, 600.0));
 	current_tick = 0;
-	accumulated_time = 0.0;
+	accumulated_nsec = 0;
 	paused = false;
-	time_scale = 1.0;
+	time_scale_numerator = 1;
+	time_scale_denominator = 1;
+	time_scale_remainder = 0;
 	initialized = true;
 	
-	// Clear helper classes
+	// Clear helper classes, a calendar's units start over from their minimum values
 	unit_manager.clear();
+	if (calendar.is_valid()) {
+		unit_table->init_state(calendar_state);
+	}
 	
-	// Initialize processor with signal callback
+	// Initialize processor, it emits time_unit_changed/tick_changes on this object
 	if (!processor) {
 		processor = new TimeUnitProcessor(&unit_manager);
 	}
-	Callable callback = callable_mp(this, &TimeTick::_emit_unit_changed);
-	processor->set_signal_callback(callback);
+	processor->set_unit_manager(unit_table, unit_state);
+	processor->set_signal_target(this, time_unit_changed_signal, tick_changes_signal);
+	processor->set_batch_changes(batch_changes_enabled);
 	
-	// Connect to SceneTree's physics_frame signal
-	SceneTree *tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
-	if (tree && !connected_to_physics) {
-		Callable physics_callback = callable_mp(this, &TimeTick::_on_physics_frame);
-		if (!tree->is_connected("physics_frame", physics_callback)) {
-			tree->connect("physics_frame", physics_callback);
-			connected_to_physics = true;
-		}
-		last_physics_time = Time::get_singleton()->get_ticks_msec() / 1000.0;
-	}
+	_publish_snapshot();
+	_connect_driver();
 }
 
 // Registers a simple time unit that increments when a tracked unit reaches trigger count
-void TimeTick::register_time_unit(const String &unit_name, const String &tracked_unit, int trigger_count, int max_value, int min_value) {
-	if (unit_name.is_empty()) {
+void TimeTick::register_time_unit(const StringName &unit_name, const StringName &tracked_unit, int trigger_count, int max_value, int min_value) {
+	if (!_check_own_units()) {
+		return;
+	}
+	
+	if (unit_name == StringName()) {
 		UtilityFunctions::push_error("TimeTick: Unit name cannot be empty");
 		return;
 	}
@@ -69,13 +71,23 @@ void TimeTick::register_time_unit(const String &unit_name, const String &tracked
 		return;
 	}
 	
+	if (unit_table->would_create_cycle(unit_name, tracked_unit)) {
+		UtilityFunctions::push_error(vformat("TimeTick: Cannot register '%s' tracking '%s', it would create a dependency cycle", unit_name, tracked_unit));
+		return;
+	}
+	
 	// Delegate to manager
-	unit_manager.register_simple_unit(unit_name, tracked_unit, trigger_count, max_value, min_value);
+	unit_table->register_simple_unit(unit_name, tracked_unit, trigger_count, max_value, min_value);
+	_publish_snapshot();
 }
 
 // Registers a complex time unit that increments when all tracked units meet specific conditions
-void TimeTick::register_complex_time_unit(const String &unit_name, const Dictionary &tracked_units, int max_value, int min_value) {
-	if (unit_name.is_empty()) {
+void TimeTick::register_complex_time_unit(const StringName &unit_name, const Dictionary &tracked_units, int max_value, int min_value) {
+	if (!_check_own_units()) {
+		return;
+	}
+	
+	if (unit_name == StringName()) {
 		UtilityFunctions::push_error("TimeTick: Unit name cannot be empty");
 		return;
 	}
@@ -89,101 +101,126 @@ void TimeTick::register_complex_time_unit(const String &unit_name, const Diction
 	Array keys = tracked_units.keys();
 	for (int i = 0; i < keys.size(); i++) {
 		String tracked_unit = keys[i];
-		if (!unit_manager.has_unit(tracked_unit) && tracked_unit != "tick") {
+		if (!unit_table->has_unit(StringName(tracked_unit)) && tracked_unit != "tick") {
 			UtilityFunctions::push_warning(vformat("TimeTick: Tracked unit '%s' not yet registered, make sure to register it first", tracked_unit));
 		}
 	}
 	
+	if (unit_table->would_create_cycle(unit_name, tracked_units)) {
+		UtilityFunctions::push_error(vformat("TimeTick: Cannot register complex unit '%s', its tracked units would create a dependency cycle", unit_name));
+		return;
+	}
+	
 	// Delegate to manager
-	unit_manager.register_complex_unit(unit_name, tracked_units, max_value, min_value);
+	unit_table->register_complex_unit(unit_name, tracked_units, max_value, min_value);
+	_publish_snapshot();
 }
 
 // Removes a time unit from the system
-void TimeTick::unregister_time_unit(const String &unit_name) {
-	unit_manager.unregister_unit(unit_name);
+void TimeTick::unregister_time_unit(const StringName &unit_name) {
+	if (!_check_own_units()) {
+		return;
+	}
+	
+	unit_table->unregister_unit(unit_name);
+	_publish_snapshot();
 }
 
 // Sets how much a time unit increments per parent unit tick
-void TimeTick::set_time_unit_step(const String &unit_name, int step_amount) {
-	if (!unit_manager.has_unit(unit_name)) {
+void TimeTick::set_time_unit_step(const StringName &unit_name, int step_amount) {
+	if (!_check_own_units()) {
+		return;
+	}
+	
+	if (!unit_table->has_unit(unit_name)) {
 		UtilityFunctions::push_error(vformat("TimeTick: Time unit '%s' not found", unit_name));
 		return;
 	}
-	unit_manager.set_step(unit_name, step_amount);
+	unit_table->set_step(unit_name, step_amount);
 }
 
 // Returns the step amount for a time unit
-int TimeTick::get_time_unit_step(const String &unit_name) const {
-	return unit_manager.get_step(unit_name);
+int TimeTick::get_time_unit_step(const StringName &unit_name) const {
+	return unit_table->get_step(unit_name);
 }
 
 // Sets how many tracked units are needed before this unit increments
-void TimeTick::set_time_unit_trigger_count(const String &unit_name, int trigger_count) {
+void TimeTick::set_time_unit_trigger_count(const StringName &unit_name, int trigger_count) {
+	if (!_check_own_units()) {
+		return;
+	}
+	
 	if (trigger_count <= 0) {
 		UtilityFunctions::push_error("TimeTick: Trigger count must be positive");
 		return;
 	}
 	
-	if (!unit_manager.has_unit(unit_name)) {
+	if (!unit_table->has_unit(unit_name)) {
 		UtilityFunctions::push_error(vformat("TimeTick: Time unit '%s' not found", unit_name));
 		return;
 	}
 	
-	if (unit_manager.is_complex(unit_name)) {
+	if (unit_table->is_complex(unit_name)) {
 		UtilityFunctions::push_error(vformat("TimeTick: Cannot set trigger_count for complex time unit '%s'. Use tracked_units dictionary instead.", unit_name));
 		return;
 	}
 	
-	unit_manager.set_trigger_count(unit_name, trigger_count);
+	unit_table->set_trigger_count(unit_name, trigger_count);
 }
 
 // Returns the trigger count for a time unit (returns -1 for complex units)
-int TimeTick::get_time_unit_trigger_count(const String &unit_name) const {
-	if (unit_manager.is_complex(unit_name)) {
+int TimeTick::get_time_unit_trigger_count(const StringName &unit_name) const {
+	if (unit_table->is_complex(unit_name)) {
 		UtilityFunctions::push_warning(vformat("TimeTick: Complex time unit '%s' doesn't have a single trigger_count. Use get_time_unit_tracked_units() instead.", unit_name));
 		return -1;
 	}
-	return unit_manager.get_trigger_count(unit_name);
+	return unit_table->get_trigger_count(unit_name);
 }
 
 // Sets the minimum value a time unit wraps back to when exceeding max
-void TimeTick::set_time_unit_starting_value(const String &unit_name, int starting_value) {
-	if (!unit_manager.has_unit(unit_name)) {
+void TimeTick::set_time_unit_starting_value(const StringName &unit_name, int starting_value) {
+	if (!_check_own_units()) {
+		return;
+	}
+	
+	if (!unit_table->has_unit(unit_name)) {
 		UtilityFunctions::push_error(vformat("TimeTick: Time unit '%s' not found", unit_name));
 		return;
 	}
-	unit_manager.set_min_value(unit_name, starting_value);
+	unit_table->set_min_value(unit_name, starting_value);
 }
 
 // Returns the starting value (minimum) for a time unit
-int TimeTick::get_time_unit_starting_value(const String &unit_name) const {
-	return unit_manager.get_min_value(unit_name);
+int TimeTick::get_time_unit_starting_value(const StringName &unit_name) const {
+	return unit_table->get_min_value(unit_name);
 }
 
 // Returns a dictionary containing all data for a time unit
-Dictionary TimeTick::get_time_unit_data(const String &unit_name) const {
-	return unit_manager.get_unit(unit_name);
+Dictionary TimeTick::get_time_unit_data(const StringName &unit_name) const {
+	int index = unit_table->find_index(unit_name);
+	if (index < 0) {
+		return Dictionary();
+	}
+	
+	Dictionary unit = unit_table->get_unit(unit_name);
+	unit["current_value"] = unit_state->values[index];
+	return unit;
 }
 
 // Returns the current value of a time unit
-int TimeTick::get_time_unit(const String &unit_name) const {
-	return unit_manager.get_value(unit_name);
+int TimeTick::get_time_unit(const StringName &unit_name) const {
+	int index = unit_table->find_index(unit_name);
+	return index >= 0 ? unit_state->values[index] : 0;
 }
 
 // Sets the current value of a time unit directly and emits signal if changed
-void TimeTick::set_time_unit(const String &unit_name, int value) {
-	if (!unit_manager.has_unit(unit_name)) {
+void TimeTick::set_time_unit(const StringName &unit_name, int value) {
+	if (!unit_table->has_unit(unit_name)) {
 		UtilityFunctions::push_error(vformat("TimeTick: Time unit '%s' not found", unit_name));
 		return;
 	}
 	
-	int old_value = unit_manager.get_value(unit_name);
-	unit_manager.set_value(unit_name, value);
-	unit_manager.set_counter(unit_name, 0);
-	
-	if (old_value != value) {
-		emit_signal("time_unit_changed", unit_name, value, old_value);
-	}
+	_set_unit_value(unit_table->find_index(unit_name), value);
 }
 
 // Sets multiple time unit values at once from a dictionary and recalculates counters
@@ -191,59 +228,255 @@ void TimeTick::set_time_units(const Dictionary &values) {
 	// First, set all the values
 	Array keys = values.keys();
 	for (int i = 0; i < keys.size(); i++) {
-		String unit_name = keys[i];
+		StringName unit_name = keys[i];
 		int value = values[unit_name];
-		if (unit_manager.has_unit(unit_name)) {
-			unit_manager.set_value(unit_name, value);
+		int index = unit_table->find_index(unit_name);
+		if (index >= 0) {
+			unit_state->values[index] = value;
 		}
 	}
 	
 	// Then recalculate all counters based on what each unit tracks
-	Array all_keys = unit_manager.get_all_unit_names();
-	for (int i = 0; i < all_keys.size(); i++) {
-		String unit_name = all_keys[i];
-		
-		// Only update counters for simple (non-complex) units
-		if (!unit_manager.is_complex(unit_name)) {
-			String tracked = unit_manager.get_tracked_unit(unit_name);
-			
-			// Set counter based on the tracked unit's current value
-			if (tracked == "tick") {
-				unit_manager.set_counter(unit_name, current_tick);
-			} else if (unit_manager.has_unit(tracked)) {
-				int tracked_value = unit_manager.get_value(tracked);
-				int tracked_step = unit_manager.get_step(tracked);
-				unit_manager.set_counter(unit_name, tracked_value * tracked_step);
-			} else {
-				unit_manager.set_counter(unit_name, 0);
-			}
-		} else {
-			unit_manager.set_counter(unit_name, 0);
-		}
-	}
+	unit_table->seed_counters(*unit_state, current_tick);
+	
+	_publish_snapshot();
 	
 	// Finally, emit signals for changed values
 	for (int i = 0; i < keys.size(); i++) {
-		String unit_name = keys[i];
-		int value = values[unit_name];
-		emit_signal("time_unit_changed", unit_name, value, value);
+		StringName unit_name = keys[i];
+		int index = unit_table->find_index(unit_name);
+		if (index >= 0) {
+			int value = values[unit_name];
+			_emit_unit_changed(index, value, value);
+		}
+	}
+}
+
+// Connects a callable that is only called when this unit changes, with (new_value, old_value)
+void TimeTick::connect_unit(const StringName &unit_name, const Callable &callable) {
+	if (!callable.is_valid()) {
+		UtilityFunctions::push_error("TimeTick: Cannot connect an invalid callable");
+		return;
+	}
+	
+	int index = unit_table->find_index(unit_name);
+	if (index < 0) {
+		UtilityFunctions::push_error(vformat("TimeTick: Time unit '%s' not found", unit_name));
+		return;
+	}
+	
+	if (unit_state->has_listener(index, callable)) {
+		UtilityFunctions::push_error(vformat("TimeTick: Callable is already connected to time unit '%s'", unit_name));
+		return;
+	}
+	
+	unit_state->add_listener(index, callable);
+}
+
+// Disconnects a callable previously connected with connect_unit
+void TimeTick::disconnect_unit(const StringName &unit_name, const Callable &callable) {
+	int index = unit_table->find_index(unit_name);
+	if (index < 0 || !unit_state->remove_listener(index, callable)) {
+		UtilityFunctions::push_error(vformat("TimeTick: Callable is not connected to time unit '%s'", unit_name));
+	}
+}
+
+// Returns true if the callable is connected to the unit with connect_unit
+bool TimeTick::is_unit_connected(const StringName &unit_name, const Callable &callable) const {
+	int index = unit_table->find_index(unit_name);
+	return index >= 0 && unit_state->has_listener(index, callable);
+}
+
+// Enables reporting each tick's unit changes with one tick_changes signal instead of time_unit_changed per unit
+void TimeTick::set_batch_changes_enabled(bool enabled) {
+	batch_changes_enabled = enabled;
+	if (processor) {
+		processor->set_batch_changes(enabled);
+	}
+}
+
+// Returns true if tick changes are reported with tick_changes
+bool TimeTick::is_batch_changes_enabled() const {
+	return batch_changes_enabled;
+}
+
+// Returns the id used for a unit in tick_changes, or -1 if the unit doesn't exist
+// An id is never handed to another unit: once its unit is unregistered the slot may be reused,
+// but with a new generation, so the old id stays invalid
+int TimeTick::get_unit_id(const StringName &unit_name) const {
+	return unit_table->find_unit_id(unit_name);
+}
+
+// Returns the name of the unit with this id, or an empty string if the id is invalid
+StringName TimeTick::get_unit_name(int unit_id) const {
+	int index = unit_table->resolve_unit_id(unit_id);
+	if (index < 0) {
+		return StringName();
+	}
+	return unit_table->get_name_at(index);
+}
+
+// Returns the current value of a time unit by id
+int TimeTick::get_time_unit_by_id(int unit_id) const {
+	int index = unit_table->resolve_unit_id(unit_id);
+	if (index < 0) {
+		return 0;
+	}
+	return unit_state->values[index];
+}
+
+// Sets the current value of a time unit by id and emits signal if changed
+void TimeTick::set_time_unit_by_id(int unit_id, int value) {
+	int index = unit_table->resolve_unit_id(unit_id);
+	if (index < 0) {
+		UtilityFunctions::push_error(vformat("TimeTick: Time unit id %d not found", unit_id));
+		return;
+	}
+	_set_unit_value(index, value);
+}
+
+// Returns the step amount for a time unit by id (returns 1 if the id is invalid, like get_time_unit_step)
+int TimeTick::get_time_unit_step_by_id(int unit_id) const {
+	int index = unit_table->resolve_unit_id(unit_id);
+	if (index < 0) {
+		return 1;
+	}
+	return unit_table->get_step_at(index);
+}
+
+// Sets how much a time unit increments per parent unit tick, by id
+void TimeTick::set_time_unit_step_by_id(int unit_id, int step_amount) {
+	if (!_check_own_units()) {
+		return;
+	}
+	
+	int index = unit_table->resolve_unit_id(unit_id);
+	if (index < 0) {
+		UtilityFunctions::push_error(vformat("TimeTick: Time unit id %d not found", unit_id));
+		return;
 	}
+	unit_table->set_step_at(index, step_amount);
+}
+
+// Returns the trigger count for a time unit by id (returns -1 for complex units, 1 if the id is invalid)
+int TimeTick::get_time_unit_trigger_count_by_id(int unit_id) const {
+	int index = unit_table->resolve_unit_id(unit_id);
+	if (index < 0) {
+		return 1;
+	}
+	if (unit_table->is_complex_at(index)) {
+		return -1;
+	}
+	return unit_table->get_trigger_count_at(index);
+}
+
+// Returns the starting value (minimum) for a time unit by id
+int TimeTick::get_time_unit_starting_value_by_id(int unit_id) const {
+	int index = unit_table->resolve_unit_id(unit_id);
+	if (index < 0) {
+		return 0;
+	}
+	return unit_table->get_min_value_at(index);
+}
+
+// Returns the ids of the complex units that triggered and are waiting for their conditions to stop being met
+PackedInt32Array TimeTick::get_triggered_units() const {
+	PackedInt32Array result = unit_state->get_triggered_units();
+	int32_t *ids = result.ptrw();
+	for (int64_t i = 0; i < result.size(); i++) {
+		ids[i] = unit_table->get_unit_id_at(ids[i]);
+	}
+	return result;
 }
 
 // Returns an array of all registered time unit names
 TypedArray<String> TimeTick::get_time_unit_names() const {
-	return unit_manager.get_all_names();
+	return unit_table->get_all_names();
+}
+
+// Uses a shared calendar's units instead of the ones registered on this TimeTick
+// Every unit starts at its minimum value, listeners connected before are dropped
+// Pass null to go back to this TimeTick's own units
+void TimeTick::set_calendar(const Ref<TimeCalendar> &p_calendar) {
+	if (p_calendar == calendar) {
+		return;
+	}
+	
+	if (calendar.is_valid()) {
+		calendar->remove_user();
+	}
+	calendar = p_calendar;
+	calendar_state.clear();
+	
+	if (calendar.is_valid()) {
+		calendar->add_user();
+		unit_table = calendar->get_definition();
+		unit_table->init_state(calendar_state);
+		unit_state = &calendar_state;
+	} else {
+		unit_table = &unit_manager;
+		unit_state = &unit_manager.get_state();
+	}
+	
+	if (processor) {
+		processor->set_unit_manager(unit_table, unit_state);
+	}
+	_publish_snapshot();
+}
+
+// Returns the calendar in use, or null when this TimeTick uses its own units
+Ref<TimeCalendar> TimeTick::get_calendar() const {
+	return calendar;
+}
+
+// Enables publishing a copy of the tick and unit values after every change, readable from other threads
+void TimeTick::set_snapshot_enabled(bool enabled) {
+	snapshot_enabled = enabled;
+	_publish_snapshot();
+}
+
+// Returns true if snapshots are published
+bool TimeTick::is_snapshot_enabled() const {
+	return snapshot_enabled;
+}
+
+// Returns the tick count of the last snapshot, safe to call from any thread
+int TimeTick::get_snapshot_tick() const {
+	return snapshot.read_tick();
+}
+
+// Returns a unit value of the last snapshot by id, safe to call from any thread
+// Only the slot part of the id is used, the unit table can't be read from other threads
+int TimeTick::get_snapshot_unit(int unit_id) const {
+	return unit_id < 0 ? 0 : snapshot.read_value(unit_id & TimeUnitManager::UNIT_ID_SLOT_MASK);
+}
+
+// Returns every unit value of the last snapshot indexed by slot, all from the same tick, safe to call from any thread
+PackedInt32Array TimeTick::get_snapshot_units() const {
+	return snapshot.read_values();
+}
+
+// Returns the tick count and every unit value of the last snapshot together, safe to call from any thread
+// Separate get_snapshot_tick/get_snapshot_units calls may straddle a tick, this can't
+Dictionary TimeTick::get_snapshot() const {
+	int tick = 0;
+	PackedInt32Array values = snapshot.read_values(&tick);
+	
+	Dictionary result;
+	result["tick"] = tick;
+	result["units"] = values;
+	return result;
 }
 
 // Returns a formatted string with time unit values replacing {unit_name} placeholders
 String TimeTick::get_formatted_time(const String &format_string) const {
 	String result = format_string;
-	Array keys = unit_manager.get_all_unit_names();
+	const LocalVector<int> &order = unit_table->get_unit_order();
 	
-	for (int i = 0; i < keys.size(); i++) {
-		String unit_name = keys[i];
-		int value = unit_manager.get_value(unit_name);
-		String placeholder = String("{") + unit_name + String("}");
+	for (uint32_t i = 0; i < order.size(); i++) {
+		int index = order[i];
+		int value = unit_state->values[index];
+		String placeholder = String("{") + String(unit_table->get_name_at(index)) + String("}");
 		result = result.replace(placeholder, String::num_int64(value));
 	}
 	
@@ -255,9 +488,10 @@ String TimeTick::get_formatted_time_padded(const TypedArray<String> &units, cons
 	PackedStringArray parts;
 	
 	for (int i = 0; i < units.size(); i++) {
-		String unit_name = units[i];
-		if (unit_manager.has_unit(unit_name)) {
-			int value = unit_manager.get_value(unit_name);
+		StringName unit_name = units[i];
+		int index = unit_table->find_index(unit_name);
+		if (index >= 0) {
+			int value = unit_state->values[index];
 			parts.append(String::num_int64(value).pad_zeros(padding));
 		} else {
 			parts.append("00");
@@ -267,20 +501,14 @@ String TimeTick::get_formatted_time_padded(const TypedArray<String> &units, cons
 	return separator.join(parts);
 }
 
-// Cleans up the time system and disconnects from physics frame
+// Cleans up the time system, releases the calendar and disconnects from the frame signal
 void TimeTick::shutdown() {
-	// Disconnect from SceneTree's physics_frame signal
-	SceneTree *tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
-	if (tree && connected_to_physics) {
-		Callable callback = callable_mp(this, &TimeTick::_on_physics_frame);
-		if (tree->is_connected("physics_frame", callback)) {
-			tree->disconnect("physics_frame", callback);
-		}
-		connected_to_physics = false;
-	}
+	_disconnect_driver();
 	
 	initialized = false;
 	unit_manager.clear();
+	set_calendar(Ref<TimeCalendar>());
+	_publish_snapshot();
 }
 
 // Pauses time progression
@@ -306,18 +534,60 @@ bool TimeTick::is_paused() const {
 // Resets tick count and all time units to their starting values
 void TimeTick::reset() {
 	current_tick = 0;
-	accumulated_time = 0.0;
-	unit_manager.reset_all_to_min();
+	accumulated_nsec = 0;
+	time_scale_remainder = 0;
+	unit_table->reset_state(*unit_state);
+	_publish_snapshot();
 }
 
 // Sets the time scale multiplier (negative values reverse time)
+// Stored as a fixed-point ratio with a resolution of one millionth
 void TimeTick::set_time_scale(double scale) {
-	time_scale = CLAMP(scale, -1000.0, 1000.0);
+	scale = CLAMP(scale, -(double)MAX_TIME_SCALE, (double)MAX_TIME_SCALE);
+	double scaled = scale * TIME_SCALE_ONE;
+	set_time_scale_ratio((int64_t)(scaled < 0.0 ? scaled - 0.5 : scaled + 0.5), TIME_SCALE_ONE);
 }
 
 // Returns the current time scale multiplier
 double TimeTick::get_time_scale() const {
-	return time_scale;
+	return (double)time_scale_numerator / time_scale_denominator;
+}
+
+// Sets the time scale as an exact ratio, e.g. (1, 3) for a third of the speed
+// Tick counts then only depend on the frame deltas, with no floating point rounding
+void TimeTick::set_time_scale_ratio(int64_t numerator, int64_t denominator) {
+	if (denominator <= 0 || denominator > TIME_SCALE_ONE) {
+		UtilityFunctions::push_error(vformat("TimeTick: Time scale denominator must be between 1 and %d", TIME_SCALE_ONE));
+		return;
+	}
+	numerator = CLAMP(numerator, -MAX_TIME_SCALE * denominator, MAX_TIME_SCALE * denominator);
+	
+	// Keep the ratio reduced so get_time_scale_numerator/denominator report it in lowest terms
+	int64_t a = numerator < 0 ? -numerator : numerator;
+	int64_t b = denominator;
+	while (b != 0) {
+		int64_t t = a % b;
+		a = b;
+		b = t;
+	}
+	if (a > 1) {
+		numerator /= a;
+		denominator /= a;
+	}
+	
+	time_scale_numerator = numerator;
+	time_scale_denominator = denominator;
+	time_scale_remainder = 0;
+}
+
+// Returns the numerator of the time scale ratio
+int64_t TimeTick::get_time_scale_numerator() const {
+	return time_scale_numerator;
+}
+
+// Returns the denominator of the time scale ratio
+int64_t TimeTick::get_time_scale_denominator() const {
+	return time_scale_denominator;
 }
 
 // Sets the tick duration in real-time seconds
@@ -326,12 +596,90 @@ void TimeTick::set_tick_duration(double duration) {
 		UtilityFunctions::push_warning("TimeTick: Tick duration must be greater than 0.0, clamping to 0.001");
 		duration = 0.001;
 	}
-	tick_time = CLAMP(duration, 0.001, 600.0);
+	tick_nsec = _seconds_to_nsec(CLAMP(duration, 0.001, 600.0));
 }
 
 // Returns the tick duration in real-time seconds
 double TimeTick::get_tick_duration() const {
-	return tick_time;
+	return (double)tick_nsec / NSEC_PER_SEC;
+}
+
+// Sets the tick duration in whole nanoseconds, for durations a float can't represent exactly
+void TimeTick::set_tick_duration_nsec(int64_t duration_nsec) {
+	if (duration_nsec <= 0) {
+		UtilityFunctions::push_warning("TimeTick: Tick duration must be greater than 0, clamping to 1000000 nanoseconds");
+	}
+	tick_nsec = CLAMP(duration_nsec, NSEC_PER_SEC / 1000, NSEC_PER_SEC * 600);
+}
+
+// Returns the tick duration in nanoseconds
+int64_t TimeTick::get_tick_duration_nsec() const {
+	return tick_nsec;
+}
+
+// Feeds elapsed real time to the clock, for loops that measure time themselves (DRIVER_MANUAL)
+// Goes through the same time scale, pause and catch-up handling as a frame
+void TimeTick::advance(double delta) {
+	if (!initialized) {
+		UtilityFunctions::push_error("TimeTick: Cannot advance time before initialize() is called");
+		return;
+	}
+	_process_tick(_seconds_to_nsec(delta));
+}
+
+// Moves time forward (or backward for negative values) by a number of ticks in one step
+// Cost doesn't depend on the tick count, each changed unit and the tick are reported once
+void TimeTick::advance_ticks(int64_t ticks) {
+	if (!initialized) {
+		UtilityFunctions::push_error("TimeTick: Cannot advance time before initialize() is called");
+		return;
+	}
+	
+	int64_t applied = _apply_ticks(ticks);
+	if (applied != 0) {
+		_emit_ticks_advanced(applied);
+	}
+}
+
+// Sets how ticks that become due in the same frame are processed
+void TimeTick::set_catch_up_mode(CatchUpMode mode) {
+	catch_up_mode = mode;
+}
+
+// Returns the current catch-up mode
+TimeTick::CatchUpMode TimeTick::get_catch_up_mode() const {
+	return catch_up_mode;
+}
+
+// Sets what drives the clock, moving it to the matching hub signal when already initialized
+void TimeTick::set_driver_mode(DriverMode mode) {
+	if (driver_mode == mode) {
+		return;
+	}
+	_disconnect_driver();
+	driver_mode = mode;
+	if (initialized) {
+		_connect_driver();
+	}
+}
+
+// Returns what drives the clock
+TimeTick::DriverMode TimeTick::get_driver_mode() const {
+	return driver_mode;
+}
+
+// Sets how many ticks CATCH_UP_CAPPED processes per frame at most
+void TimeTick::set_max_ticks_per_frame(int max_ticks) {
+	if (max_ticks <= 0) {
+		UtilityFunctions::push_warning("TimeTick: Max ticks per frame must be positive, clamping to 1");
+		max_ticks = 1;
+	}
+	max_ticks_per_frame = max_ticks;
+}
+
+// Returns how many ticks CATCH_UP_CAPPED processes per frame at most
+int TimeTick::get_max_ticks_per_frame() const {
+	return max_ticks_per_frame;
 }
 
 // Returns the current tick count
@@ -341,10 +689,10 @@ int TimeTick::get_current_tick() const {
 
 // Returns progress to next tick as a value between 0.0 and 1.0
 double TimeTick::get_tick_progress() const {
-	if (tick_time <= 0.0) {
+	if (tick_nsec <= 0) {
 		return 0.0;
 	}
-	return CLAMP(accumulated_time / tick_time, 0.0, 1.0);
+	return CLAMP((double)accumulated_nsec / tick_nsec, 0.0, 1.0);
 }
 
 // Returns true if the system has been initialized
@@ -353,34 +701,87 @@ bool TimeTick::is_initialized() const {
 }
 
 
+// Returns how many times the processor grew or copied its own buffers since initialization
+// Diagnostic only: allocations outside the processor (signal emission, listeners) aren't seen,
+// and the count grows while the buffers warm up after registration
+int64_t TimeTick::get_tick_allocation_count() const {
+	return processor ? (int64_t)processor->get_allocation_count() : 0;
+}
+
+
 // Private methods
-// Called every physics frame to process time progression
-void TimeTick::_on_physics_frame() {
-	if (!initialized) {
+// Registers the clock with the shared hub for the frame signal of the driver mode
+// The hub holds the SceneTree connection and samples the time once for every clock
+void TimeTick::_connect_driver() {
+	if (driver_mode == DRIVER_MANUAL || driven_by_hub) {
 		return;
 	}
-	
-	double current_time = Time::get_singleton()->get_ticks_msec() / 1000.0;
-	double delta = current_time - last_physics_time;
-	last_physics_time = current_time;
-	_process_tick(delta);
+	last_frame_usec = Time::get_singleton()->get_ticks_usec();
+	TimeTickHub::add_clock(this, _get_hub_frame());
+	driven_by_hub = true;
+}
+
+// Unregisters the clock from the shared hub, if registered
+void TimeTick::_disconnect_driver() {
+	if (!driven_by_hub) {
+		return;
+	}
+	TimeTickHub::remove_clock(this, _get_hub_frame());
+	driven_by_hub = false;
+}
+
+// Returns the hub frame signal matching the driver mode
+TimeTickHub::Frame TimeTick::_get_hub_frame() const {
+	return driver_mode == DRIVER_PROCESS ? TimeTickHub::FRAME_PROCESS : TimeTickHub::FRAME_PHYSICS;
+}
+
+// Multiplies a frame delta by the time scale ratio with integer math only
+// The delta is split around the denominator so the products stay in range, and the division
+// remainder is carried to the next frame: the sum of scaled deltas is exact over any number of frames
+int64_t TimeTick::_scale_delta(int64_t delta_nsec) {
+	int64_t whole = delta_nsec / time_scale_denominator;
+	int64_t part = delta_nsec % time_scale_denominator;
+	int64_t remainder = part * time_scale_numerator + time_scale_remainder;
+	time_scale_remainder = remainder % time_scale_denominator;
+	return whole * time_scale_numerator + remainder / time_scale_denominator;
+}
+
+// Converts a duration in seconds to the nearest whole nanosecond
+int64_t TimeTick::_seconds_to_nsec(double seconds) {
+	double nsec = seconds * NSEC_PER_SEC;
+	return (int64_t)(nsec < 0.0 ? nsec - 0.5 : nsec + 0.5);
 }
 
 // Processes time accumulation and triggers ticks (supports forward and backward time)
-void TimeTick::_process_tick(double delta) {
+void TimeTick::_process_tick(int64_t delta_nsec) {
 	if (paused) {
 		return;
 	}
 	
 	// Apply time scale
-	double scaled_delta = delta * time_scale;
-	accumulated_time += scaled_delta;
+	accumulated_nsec += _scale_delta(delta_nsec);
 	
 	// Handle forward time (positive time_scale)
-	if (time_scale >= 0.0) {
+	if (time_scale_numerator >= 0) {
+		int64_t pending = accumulated_nsec / tick_nsec;
+		
+		// Capped mode drops the time of ticks above the per-frame budget, before any catch-up shortcut
+		if (catch_up_mode == CATCH_UP_CAPPED && pending > max_ticks_per_frame) {
+			accumulated_nsec -= (pending - max_ticks_per_frame) * tick_nsec;
+			pending = max_ticks_per_frame;
+		}
+		
+		// Coalesced mode applies every due tick in one step, per-tick mode never takes this shortcut
+		// (complex units and tick_updated listeners see every tick)
+		if (pending > 0 && catch_up_mode == CATCH_UP_COALESCED) {
+			accumulated_nsec -= pending * tick_nsec;
+			advance_ticks(pending);
+			return;
+		}
+		
 		// Process all ticks that should have occurred
-		while (accumulated_time >= tick_time) {
-			accumulated_time -= tick_time;
+		while (accumulated_nsec >= tick_nsec) {
+			accumulated_nsec -= tick_nsec;
 			
 			// Check for overflow - reset to 0 if we exceed INT_MAX
 			if (current_tick >= INT_MAX) {
@@ -390,58 +791,153 @@ void TimeTick::_process_tick(double delta) {
 				current_tick += 1;
 			}
 			
-			// Increment the "tick" unit
-			_increment_unit("tick");
+			// Run the "tick" unit cascade
+			_tick_forward();
 			
 			// Emit signal
-			emit_signal("tick_updated", current_tick);
+			emit_signal(tick_updated_signal, current_tick);
 		}
 	} else {
 		// Handle backward time (negative time_scale)
-		// accumulated_time will be negative, so we check if it's <= -tick_time
-		while (accumulated_time <= -tick_time) {
-			accumulated_time += tick_time;
+		// accumulated_nsec will be negative, so we check if it's <= -tick_nsec
+		int64_t pending = -accumulated_nsec / tick_nsec;
+		
+		// Capped mode drops the time of ticks above the per-frame budget, before any catch-up shortcut
+		if (catch_up_mode == CATCH_UP_CAPPED && pending > max_ticks_per_frame) {
+			accumulated_nsec += (pending - max_ticks_per_frame) * tick_nsec;
+			pending = max_ticks_per_frame;
+		}
+		
+		// Coalesced mode applies every due tick in one step
+		if (pending > 0 && catch_up_mode == CATCH_UP_COALESCED) {
+			accumulated_nsec += pending * tick_nsec;
+			if (pending > current_tick) {
+				// Stop decrementing to prevent going negative
+				accumulated_nsec = 0;
+			}
+			advance_ticks(-pending);
+			return;
+		}
+		
+		while (accumulated_nsec <= -tick_nsec) {
+			accumulated_nsec += tick_nsec;
 			
 			// Check for underflow - reset to 0 if we go below 0
 			if (current_tick <= 0) {
 				current_tick = 0;
 				UtilityFunctions::push_warning("TimeTick: Tick count reached minimum value (0), cannot decrement further");
 				// Stop decrementing to prevent going negative
-				accumulated_time = 0.0;
+				accumulated_nsec = 0;
 				break;
 			} else {
 				current_tick -= 1;
 			}
 			
-			// Decrement the "tick" unit
-			_decrement_unit("tick");
+			// Run the reverse "tick" unit cascade
+			_tick_backward();
 			
 			// Emit signal
-			emit_signal("tick_updated", current_tick);
+			emit_signal(tick_updated_signal, current_tick);
 		}
 	}
 }
 
-// Increments a time unit and processes cascading effects
-void TimeTick::_increment_unit(const String &unit_name) {
+// Moves the tick count and runs the cascade for advance_ticks, without emitting the tick signals
+// Returns the ticks actually applied, negative when rewinding and 0 if nothing changed
+// Only touches this clock's own data, so TimeTickServer can run it on worker threads
+int64_t TimeTick::_apply_ticks(int64_t ticks) {
+	if (ticks > 0) {
+		// Tick count wraps back to 0 after INT_MAX, like the per-tick path
+		// ticks is reduced first, so even INT64_MAX can't overflow the sum
+		if (ticks > (int64_t)INT_MAX - current_tick) {
+			UtilityFunctions::push_warning("TimeTick: Tick count reached maximum value, resetting to 0");
+		}
+		current_tick = (int)(((int64_t)current_tick + ticks % ((int64_t)INT_MAX + 1)) % ((int64_t)INT_MAX + 1));
+		processor->set_current_tick(current_tick);
+		processor->advance_forward(ticks);
+		_publish_snapshot();
+		return ticks;
+	}
+	
+	if (ticks < 0) {
+		// Tick count can't go below 0
+		// Compared before negating, -INT64_MIN doesn't fit
+		int64_t rewind = ticks < -(int64_t)current_tick ? (int64_t)current_tick : -ticks;
+		if (ticks < -(int64_t)current_tick) {
+			UtilityFunctions::push_warning("TimeTick: Tick count reached minimum value (0), cannot decrement further");
+		}
+		if (rewind == 0) {
+			return 0;
+		}
+		current_tick -= (int)rewind;
+		processor->set_current_tick(current_tick);
+		processor->advance_backward(rewind);
+		_publish_snapshot();
+		return -rewind;
+	}
+	
+	return 0;
+}
+
+// Emits tick_updated and ticks_advanced after a multi-tick jump
+void TimeTick::_emit_ticks_advanced(int64_t ticks) {
+	emit_signal(tick_updated_signal, current_tick);
+	emit_signal(ticks_advanced_signal, current_tick, ticks);
+}
+
+// Advances every time unit by one tick and processes cascading effects
+void TimeTick::_tick_forward() {
 	if (processor) {
 		processor->set_current_tick(current_tick);
-		processor->increment_unit(unit_name);
+		processor->process_tick_forward();
 	}
+	_publish_snapshot();
 }
 
-// Decrements a time unit and processes cascading effects
-void TimeTick::_decrement_unit(const String &unit_name) {
+// Rewinds every time unit by one tick and processes cascading effects
+void TimeTick::_tick_backward() {
 	if (processor) {
 		processor->set_current_tick(current_tick);
-		processor->decrement_unit(unit_name);
+		processor->process_tick_backward();
+	}
+	_publish_snapshot();
+}
+
+// Reports an error and returns false when units come from a calendar, which must be edited instead
+bool TimeTick::_check_own_units() const {
+	if (calendar.is_valid()) {
+		UtilityFunctions::push_error("TimeTick: Cannot change the units of a shared TimeCalendar, edit the calendar before setting it instead");
+		return false;
+	}
+	return true;
+}
+
+// Copies the tick and unit values into the snapshot read by other threads
+void TimeTick::_publish_snapshot() {
+	if (snapshot_enabled) {
+		snapshot.publish(current_tick, unit_state->values);
+	}
+}
+
+// Sets a unit value directly, recalculates the counters and reports the change
+void TimeTick::_set_unit_value(int unit_index, int value) {
+	int old_value = unit_state->values[unit_index];
+	unit_state->values[unit_index] = value;
+	unit_table->seed_counters(*unit_state, current_tick);
+	_publish_snapshot();
+	
+	if (old_value != value) {
+		_emit_unit_changed(unit_index, value, old_value);
 	}
 }
 
-// Emits the time_unit_changed signal when a unit value changes
-// Signal emission helper (called by processor via callback)
-void TimeTick::_emit_unit_changed(const String &name, int new_val, int old_val) {
-	emit_signal("time_unit_changed", name, new_val, old_val);
+// Reports a unit change to time_unit_changed and the unit's own listeners
+void TimeTick::_emit_unit_changed(int unit_index, int new_val, int old_val) {
+	if (processor) {
+		processor->emit_change_signal(unit_index, new_val, old_val);
+	} else {
+		emit_signal(time_unit_changed_signal, unit_table->get_name_at(unit_index), new_val, old_val);
+	}
 }
 
 // Registers all methods, properties, and signals with Godot's ClassDB
@@ -449,8 +945,16 @@ void TimeTick::_emit_unit_changed(const String &name, int new_val, int old_val)
 void TimeTick::_bind_methods() {
 	// Signals
 	ADD_SIGNAL(MethodInfo("tick_updated", PropertyInfo(Variant::INT, "current_tick")));
+	ADD_SIGNAL(MethodInfo("ticks_advanced",
+		PropertyInfo(Variant::INT, "current_tick"),
+		PropertyInfo(Variant::INT, "ticks_elapsed")));
+	ADD_SIGNAL(MethodInfo("tick_changes",
+		PropertyInfo(Variant::INT, "current_tick"),
+		PropertyInfo(Variant::PACKED_INT32_ARRAY, "unit_ids"),
+		PropertyInfo(Variant::PACKED_INT32_ARRAY, "new_values"),
+		PropertyInfo(Variant::PACKED_INT32_ARRAY, "old_values")));
 	ADD_SIGNAL(MethodInfo("time_unit_changed", 
-		PropertyInfo(Variant::STRING, "unit_name"), 
+		PropertyInfo(Variant::STRING_NAME, "unit_name"), 
 		PropertyInfo(Variant::INT, "new_value"), 
 		PropertyInfo(Variant::INT, "old_value")));
 	
@@ -472,6 +976,28 @@ void TimeTick::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_time_unit", "unit_name", "value"), &TimeTick::set_time_unit);
 	ClassDB::bind_method(D_METHOD("set_time_units", "values"), &TimeTick::set_time_units);
 	ClassDB::bind_method(D_METHOD("get_time_unit_names"), &TimeTick::get_time_unit_names);
+	ClassDB::bind_method(D_METHOD("set_calendar", "calendar"), &TimeTick::set_calendar);
+	ClassDB::bind_method(D_METHOD("get_calendar"), &TimeTick::get_calendar);
+	ClassDB::bind_method(D_METHOD("set_snapshot_enabled", "enabled"), &TimeTick::set_snapshot_enabled);
+	ClassDB::bind_method(D_METHOD("is_snapshot_enabled"), &TimeTick::is_snapshot_enabled);
+	ClassDB::bind_method(D_METHOD("get_snapshot_tick"), &TimeTick::get_snapshot_tick);
+	ClassDB::bind_method(D_METHOD("get_snapshot_unit", "unit_id"), &TimeTick::get_snapshot_unit);
+	ClassDB::bind_method(D_METHOD("get_snapshot_units"), &TimeTick::get_snapshot_units);
+	ClassDB::bind_method(D_METHOD("get_snapshot"), &TimeTick::get_snapshot);
+	ClassDB::bind_method(D_METHOD("get_unit_name", "unit_id"), &TimeTick::get_unit_name);
+	ClassDB::bind_method(D_METHOD("get_time_unit_by_id", "unit_id"), &TimeTick::get_time_unit_by_id);
+	ClassDB::bind_method(D_METHOD("set_time_unit_by_id", "unit_id", "value"), &TimeTick::set_time_unit_by_id);
+	ClassDB::bind_method(D_METHOD("get_time_unit_step_by_id", "unit_id"), &TimeTick::get_time_unit_step_by_id);
+	ClassDB::bind_method(D_METHOD("set_time_unit_step_by_id", "unit_id", "step_amount"), &TimeTick::set_time_unit_step_by_id);
+	ClassDB::bind_method(D_METHOD("get_time_unit_trigger_count_by_id", "unit_id"), &TimeTick::get_time_unit_trigger_count_by_id);
+	ClassDB::bind_method(D_METHOD("get_time_unit_starting_value_by_id", "unit_id"), &TimeTick::get_time_unit_starting_value_by_id);
+	ClassDB::bind_method(D_METHOD("get_triggered_units"), &TimeTick::get_triggered_units);
+	ClassDB::bind_method(D_METHOD("set_batch_changes_enabled", "enabled"), &TimeTick::set_batch_changes_enabled);
+	ClassDB::bind_method(D_METHOD("is_batch_changes_enabled"), &TimeTick::is_batch_changes_enabled);
+	ClassDB::bind_method(D_METHOD("get_unit_id", "unit_name"), &TimeTick::get_unit_id);
+	ClassDB::bind_method(D_METHOD("connect_unit", "unit_name", "callable"), &TimeTick::connect_unit);
+	ClassDB::bind_method(D_METHOD("disconnect_unit", "unit_name", "callable"), &TimeTick::disconnect_unit);
+	ClassDB::bind_method(D_METHOD("is_unit_connected", "unit_name", "callable"), &TimeTick::is_unit_connected);
 	ClassDB::bind_method(D_METHOD("get_formatted_time", "format_string"), &TimeTick::get_formatted_time);
 	ClassDB::bind_method(D_METHOD("get_formatted_time_padded", "units", "separator", "padding"), 
 		&TimeTick::get_formatted_time_padded, DEFVAL(":"), DEFVAL(2));
@@ -483,9 +1009,32 @@ void TimeTick::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("reset"), &TimeTick::reset);
 	ClassDB::bind_method(D_METHOD("set_time_scale", "scale"), &TimeTick::set_time_scale);
 	ClassDB::bind_method(D_METHOD("get_time_scale"), &TimeTick::get_time_scale);
+	ClassDB::bind_method(D_METHOD("set_time_scale_ratio", "numerator", "denominator"), &TimeTick::set_time_scale_ratio);
+	ClassDB::bind_method(D_METHOD("get_time_scale_numerator"), &TimeTick::get_time_scale_numerator);
+	ClassDB::bind_method(D_METHOD("get_time_scale_denominator"), &TimeTick::get_time_scale_denominator);
 	ClassDB::bind_method(D_METHOD("set_tick_duration", "duration"), &TimeTick::set_tick_duration);
 	ClassDB::bind_method(D_METHOD("get_tick_duration"), &TimeTick::get_tick_duration);
+	ClassDB::bind_method(D_METHOD("set_tick_duration_nsec", "duration_nsec"), &TimeTick::set_tick_duration_nsec);
+	ClassDB::bind_method(D_METHOD("get_tick_duration_nsec"), &TimeTick::get_tick_duration_nsec);
+	ClassDB::bind_method(D_METHOD("advance", "delta"), &TimeTick::advance);
+	ClassDB::bind_method(D_METHOD("advance_ticks", "ticks"), &TimeTick::advance_ticks);
+	ClassDB::bind_method(D_METHOD("set_driver_mode", "mode"), &TimeTick::set_driver_mode);
+	ClassDB::bind_method(D_METHOD("get_driver_mode"), &TimeTick::get_driver_mode);
+	ClassDB::bind_method(D_METHOD("set_catch_up_mode", "mode"), &TimeTick::set_catch_up_mode);
+	ClassDB::bind_method(D_METHOD("get_catch_up_mode"), &TimeTick::get_catch_up_mode);
+	ClassDB::bind_method(D_METHOD("set_max_ticks_per_frame", "max_ticks"), &TimeTick::set_max_ticks_per_frame);
+	ClassDB::bind_method(D_METHOD("get_max_ticks_per_frame"), &TimeTick::get_max_ticks_per_frame);
 	ClassDB::bind_method(D_METHOD("get_current_tick"), &TimeTick::get_current_tick);
 	ClassDB::bind_method(D_METHOD("get_tick_progress"), &TimeTick::get_tick_progress);
 	ClassDB::bind_method(D_METHOD("is_initialized"), &TimeTick::is_initialized);
+	ClassDB::bind_method(D_METHOD("get_tick_allocation_count"), &TimeTick::get_tick_allocation_count);
+	
+	// Enums
+	BIND_ENUM_CONSTANT(CATCH_UP_PER_TICK);
+	BIND_ENUM_CONSTANT(CATCH_UP_COALESCED);
+	BIND_ENUM_CONSTANT(CATCH_UP_CAPPED);
+	
+	BIND_ENUM_CONSTANT(DRIVER_PHYSICS);
+	BIND_ENUM_CONSTANT(DRIVER_PROCESS);
+	BIND_ENUM_CONSTANT(DRIVER_MANUAL);
 }
@@ -4,11 +4,14 @@
 #pragma once
 
 #include <godot_cpp/classes/ref_counted.hpp>
-#include <godot_cpp/classes/scene_tree.hpp>
 #include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
 #include <godot_cpp/variant/typed_array.hpp>
 
 // Helper classes
+#include "time_calendar.hpp"
+#include "time_tick_hub.hpp"
+#include "time_tick_snapshot.hpp"
 #include "time_unit_manager.hpp"
 #include "time_unit_processor.hpp"
 
@@ -16,19 +19,24 @@ using namespace godot;
 
 class TimeTick : public RefCounted {
 	GDCLASS(TimeTick, RefCounted)
+	
+	// The hub and the server advance clocks directly
+	friend class TimeTickHub;
+	friend class TimeTickServer;
 
 public:
-	struct TimeUnit {
-		String name = "";
-		int current_value = 0;
-		String tracked_unit = "";
-		int trigger_count = 1;
-		int step_amount = 1;
-		int max_value = -1;
-		
-		TimeUnit() = default;
-		TimeUnit(const String &p_name, const String &p_tracked, int p_trigger_count, int p_step = 1, int p_max = -1)
-			: name(p_name), tracked_unit(p_tracked), trigger_count(p_trigger_count), step_amount(p_step), max_value(p_max) {}
+	// How _process_tick handles several ticks becoming due in the same frame
+	enum CatchUpMode {
+		CATCH_UP_PER_TICK, // Every tick is processed and reported on its own
+		CATCH_UP_COALESCED, // All due ticks are applied as one batch and reported once
+		CATCH_UP_CAPPED, // At most max_ticks_per_frame ticks are processed, excess time is dropped
+	};
+
+	// What measures time and feeds it to the clock
+	enum DriverMode {
+		DRIVER_PHYSICS, // SceneTree physics_frame, timed with the monotonic clock
+		DRIVER_PROCESS, // SceneTree process_frame, timed with the monotonic clock
+		DRIVER_MANUAL, // Nothing connected, time only moves through advance()/advance_ticks()
 	};
 
 	TimeTick();
@@ -39,25 +47,57 @@ public:
 	void shutdown();
 	
 	// Time unit registration
-	void register_time_unit(const String &unit_name, const String &tracked_unit, int trigger_count = 1, int max_value = -1, int min_value = 0);
-	void register_complex_time_unit(const String &unit_name, const Dictionary &tracked_units, int max_value = -1, int min_value = 0);
-	void unregister_time_unit(const String &unit_name);
+	void register_time_unit(const StringName &unit_name, const StringName &tracked_unit, int trigger_count = 1, int max_value = -1, int min_value = 0);
+	void register_complex_time_unit(const StringName &unit_name, const Dictionary &tracked_units, int max_value = -1, int min_value = 0);
+	void unregister_time_unit(const StringName &unit_name);
 	
 	// Time unit property setters
-	void set_time_unit_step(const String &unit_name, int step_amount);
-	void set_time_unit_trigger_count(const String &unit_name, int trigger_count);
-	void set_time_unit_starting_value(const String &unit_name, int starting_value);
-	void set_time_unit(const String &unit_name, int value);
+	void set_time_unit_step(const StringName &unit_name, int step_amount);
+	void set_time_unit_trigger_count(const StringName &unit_name, int trigger_count);
+	void set_time_unit_starting_value(const StringName &unit_name, int starting_value);
+	void set_time_unit(const StringName &unit_name, int value);
 	void set_time_units(const Dictionary &values);
 	
 	// Time unit property getters
-	int get_time_unit_step(const String &unit_name) const;
-	int get_time_unit_trigger_count(const String &unit_name) const;
-	int get_time_unit_starting_value(const String &unit_name) const;
-	int get_time_unit(const String &unit_name) const;
-	Dictionary get_time_unit_data(const String &unit_name) const;
+	int get_time_unit_step(const StringName &unit_name) const;
+	int get_time_unit_trigger_count(const StringName &unit_name) const;
+	int get_time_unit_starting_value(const StringName &unit_name) const;
+	int get_time_unit(const StringName &unit_name) const;
+	Dictionary get_time_unit_data(const StringName &unit_name) const;
 	TypedArray<String> get_time_unit_names() const;
 	
+	// Shared unit definitions
+	void set_calendar(const Ref<TimeCalendar> &p_calendar);
+	Ref<TimeCalendar> get_calendar() const;
+	
+	// Thread-safe snapshots, readable from worker threads
+	void set_snapshot_enabled(bool enabled);
+	bool is_snapshot_enabled() const;
+	int get_snapshot_tick() const;
+	int get_snapshot_unit(int unit_id) const;
+	PackedInt32Array get_snapshot_units() const;
+	Dictionary get_snapshot() const;
+	
+	// Per-unit change listeners
+	void connect_unit(const StringName &unit_name, const Callable &callable);
+	void disconnect_unit(const StringName &unit_name, const Callable &callable);
+	bool is_unit_connected(const StringName &unit_name, const Callable &callable) const;
+	
+	// Id based access, skips the name lookup (ids come from get_unit_id)
+	StringName get_unit_name(int unit_id) const;
+	int get_time_unit_by_id(int unit_id) const;
+	void set_time_unit_by_id(int unit_id, int value);
+	int get_time_unit_step_by_id(int unit_id) const;
+	void set_time_unit_step_by_id(int unit_id, int step_amount);
+	int get_time_unit_trigger_count_by_id(int unit_id) const;
+	int get_time_unit_starting_value_by_id(int unit_id) const;
+	PackedInt32Array get_triggered_units() const;
+	
+	// Batched change reports
+	void set_batch_changes_enabled(bool enabled);
+	bool is_batch_changes_enabled() const;
+	int get_unit_id(const StringName &unit_name) const;
+	
 	// Time formatting
 	String get_formatted_time(const String &format_string) const;
 	String get_formatted_time_padded(const TypedArray<String> &units, const String &separator = ":", int padding = 2) const;
@@ -72,41 +112,99 @@ public:
 	// Time scale and tick control
 	void set_time_scale(double scale);
 	double get_time_scale() const;
+	void set_time_scale_ratio(int64_t numerator, int64_t denominator);
+	int64_t get_time_scale_numerator() const;
+	int64_t get_time_scale_denominator() const;
 	void set_tick_duration(double duration);
 	double get_tick_duration() const;
+	void set_tick_duration_nsec(int64_t duration_nsec);
+	int64_t get_tick_duration_nsec() const;
+	void set_catch_up_mode(CatchUpMode mode);
+	CatchUpMode get_catch_up_mode() const;
+	void set_max_ticks_per_frame(int max_ticks);
+	int get_max_ticks_per_frame() const;
+	void set_driver_mode(DriverMode mode);
+	DriverMode get_driver_mode() const;
+	
+	// Fast-forward/rewind
+	void advance(double delta);
+	void advance_ticks(int64_t ticks);
 	
 	// Status queries
 	int get_current_tick() const;
 	double get_tick_progress() const;
 	bool is_initialized() const;
+	int64_t get_tick_allocation_count() const;
 
 protected:
 	static void _bind_methods();
 
 private:
-	// Time system state
-	double tick_time = 1.0;
+	
+	static constexpr int64_t NSEC_PER_SEC = 1000000000;
+	// Fixed-point resolution of set_time_scale, and the largest denominator set_time_scale_ratio accepts
+	static constexpr int64_t TIME_SCALE_ONE = 1000000;
+	static constexpr int64_t MAX_TIME_SCALE = 1000;
+	
+	// Time system state, kept in integer nanoseconds so timing doesn't drift over long sessions
+	int64_t tick_nsec = NSEC_PER_SEC;
 	int current_tick = 0;
-	double time_scale = 1.0;
-	double accumulated_time = 0.0;
-	double last_physics_time = 0.0;
+	// Time scale as the exact ratio numerator / denominator, the division remainder carries to the next frame
+	int64_t time_scale_numerator = 1;
+	int64_t time_scale_denominator = 1;
+	int64_t time_scale_remainder = 0;
+	int64_t accumulated_nsec = 0;
+	uint64_t last_frame_usec = 0;
+	CatchUpMode catch_up_mode = CATCH_UP_PER_TICK;
+	int max_ticks_per_frame = 8;
+	
+	// Signal names, built once instead of on every emission
+	StringName tick_updated_signal = "tick_updated";
+	StringName ticks_advanced_signal = "ticks_advanced";
+	StringName time_unit_changed_signal = "time_unit_changed";
+	StringName tick_changes_signal = "tick_changes";
+	bool batch_changes_enabled = false;
 	
 	// Helper classes for internal organization
 	TimeUnitManager unit_manager;
 	TimeUnitProcessor *processor = nullptr;
 	
+	// Unit table in use and the values it runs on: unit_manager and its own state,
+	// or the calendar's definition and calendar_state
+	Ref<TimeCalendar> calendar;
+	TimeUnitState calendar_state;
+	TimeUnitManager *unit_table = &unit_manager;
+	TimeUnitState *unit_state = &unit_manager.get_state();
+	
+	// Copy of the tick and unit values for other threads, published after every change when enabled
+	TimeTickSnapshot snapshot;
+	bool snapshot_enabled = false;
+	
 	// Status flags
 	bool paused = false;
 	bool initialized = false;
-	bool connected_to_physics = false;
+	DriverMode driver_mode = DRIVER_PHYSICS;
+	// True while registered with the shared TimeTickHub
+	bool driven_by_hub = false;
+	// True while a TimeTickServer batch advances this clock
+	bool in_batch = false;
 	
 	// Internal processing
-	void _on_physics_frame();
-	void _process_tick(double delta);
-	void _increment_unit(const String &unit_name);
-	void _decrement_unit(const String &unit_name);
-	
-	// Signal emission helper (called by processor)
-	void _emit_unit_changed(const String &name, int new_val, int old_val);
+	void _connect_driver();
+	void _disconnect_driver();
+	TimeTickHub::Frame _get_hub_frame() const;
+	void _process_tick(int64_t delta_nsec);
+	static int64_t _seconds_to_nsec(double seconds);
+	int64_t _scale_delta(int64_t delta_nsec);
+	int64_t _apply_ticks(int64_t ticks);
+	void _emit_ticks_advanced(int64_t ticks);
+	void _tick_forward();
+	void _tick_backward();
+	bool _check_own_units() const;
+	void _publish_snapshot();
+	void _emit_unit_changed(int unit_index, int new_val, int old_val);
+	void _set_unit_value(int unit_index, int value);
 };
 
+VARIANT_ENUM_CAST(TimeTick::CatchUpMode);
+VARIANT_ENUM_CAST(TimeTick::DriverMode);
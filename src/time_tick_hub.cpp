@@ -0,0 +1,164 @@
+// MIT License
+// Copyright (c) 2025 Lucas "Shoyguer" Melo
+
+#include "time_tick_hub.hpp"
+#include "time_tick.hpp"
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/time.hpp>
+
+using namespace godot;
+
+
+TimeTickHub::Driver TimeTickHub::drivers[TimeTickHub::FRAME_MAX];
+
+// Registers a clock to be advanced on every frame of the given signal
+// The first clock of a signal connects the hub to the SceneTree
+void TimeTickHub::add_clock(TimeTick *clock, Frame frame) {
+	Driver &driver = drivers[frame];
+	if (driver.clocks.has(clock)) {
+		return;
+	}
+	driver.clocks.push_back(clock);
+
+	if (!driver.connected) {
+		_connect(frame);
+	}
+}
+
+// Unregisters a clock, the last clock of a signal disconnects the hub
+// Safe to call from a clock's own signal handlers while the hub is advancing clocks
+void TimeTickHub::remove_clock(TimeTick *clock, Frame frame) {
+	Driver &driver = drivers[frame];
+	int64_t index = driver.clocks.find(clock);
+	if (index < 0) {
+		return;
+	}
+
+	if (driver.dispatching) {
+		driver.clocks[index] = nullptr;
+		driver.has_removed = true;
+		return;
+	}
+
+	driver.clocks.remove_at(index);
+	if (driver.clocks.is_empty()) {
+		_disconnect(frame);
+	}
+}
+
+// Returns how many clocks are driven by a signal
+int TimeTickHub::get_clock_count(Frame frame) {
+	const Driver &driver = drivers[frame];
+	int count = 0;
+	for (uint32_t i = 0; i < driver.clocks.size(); i++) {
+		if (driver.clocks[i]) {
+			count++;
+		}
+	}
+	return count;
+}
+
+// Drops the connections and releases the registries
+void TimeTickHub::cleanup() {
+	for (int frame = 0; frame < FRAME_MAX; frame++) {
+		_disconnect((Frame)frame);
+		drivers[frame].clocks.reset();
+		drivers[frame].has_removed = false;
+	}
+}
+
+void TimeTickHub::_on_physics_frame() {
+	_dispatch(FRAME_PHYSICS);
+}
+
+void TimeTickHub::_on_process_frame() {
+	_dispatch(FRAME_PROCESS);
+}
+
+// Advances every clock of a signal with a single time sample
+// Paused clocks are skipped, their elapsed time is dropped like before
+void TimeTickHub::_dispatch(Frame frame) {
+	Driver &driver = drivers[frame];
+	uint64_t current_usec = Time::get_singleton()->get_ticks_usec();
+
+	// Clocks added by a signal handler are appended and picked up in this same pass, removed ones are null
+	driver.dispatching = true;
+	for (uint32_t i = 0; i < driver.clocks.size(); i++) {
+		TimeTick *clock = driver.clocks[i];
+		if (!clock) {
+			continue;
+		}
+
+		int64_t delta_usec = (int64_t)(current_usec - clock->last_frame_usec);
+		clock->last_frame_usec = current_usec;
+		if (clock->paused) {
+			continue;
+		}
+		clock->_process_tick(delta_usec * 1000);
+	}
+	driver.dispatching = false;
+
+	if (driver.has_removed) {
+		_compact(frame);
+	}
+}
+
+// Removes the entries nulled while dispatching, keeping registration order
+void TimeTickHub::_compact(Frame frame) {
+	Driver &driver = drivers[frame];
+	uint32_t kept = 0;
+	for (uint32_t i = 0; i < driver.clocks.size(); i++) {
+		if (driver.clocks[i]) {
+			driver.clocks[kept++] = driver.clocks[i];
+		}
+	}
+	driver.clocks.resize(kept);
+	driver.has_removed = false;
+
+	if (driver.clocks.is_empty()) {
+		_disconnect(frame);
+	}
+}
+
+// Connects the hub to a SceneTree frame signal
+// Without a SceneTree (e.g. a custom main loop) clocks stay registered but are never advanced
+void TimeTickHub::_connect(Frame frame) {
+	SceneTree *tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	if (!tree) {
+		return;
+	}
+
+	Callable callback = _get_callback(frame);
+	if (!tree->is_connected(_get_signal(frame), callback)) {
+		tree->connect(_get_signal(frame), callback);
+	}
+	drivers[frame].connected = true;
+}
+
+// Disconnects the hub from a SceneTree frame signal, if connected
+void TimeTickHub::_disconnect(Frame frame) {
+	Driver &driver = drivers[frame];
+	if (!driver.connected) {
+		return;
+	}
+
+	SceneTree *tree = Object::cast_to<SceneTree>(Engine::get_singleton()->get_main_loop());
+	if (tree) {
+		Callable callback = _get_callback(frame);
+		if (tree->is_connected(_get_signal(frame), callback)) {
+			tree->disconnect(_get_signal(frame), callback);
+		}
+	}
+	driver.connected = false;
+}
+
+// Returns the SceneTree signal of a frame type
+StringName TimeTickHub::_get_signal(Frame frame) {
+	return frame == FRAME_PROCESS ? StringName("process_frame") : StringName("physics_frame");
+}
+
+// Returns the static callable connected for a frame type
+Callable TimeTickHub::_get_callback(Frame frame) {
+	return frame == FRAME_PROCESS ? callable_mp_static(&TimeTickHub::_on_process_frame) : callable_mp_static(&TimeTickHub::_on_physics_frame);
+}
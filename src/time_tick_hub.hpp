@@ -0,0 +1,55 @@
+// MIT License
+// Copyright (c) 2025 Lucas "Shoyguer" Melo
+
+#pragma once
+
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/callable.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+
+using namespace godot;
+
+class TimeTick;
+
+// Internal helper shared by every TimeTick instance
+// This is NOT exposed to Godot. This is just for internal organization.
+//
+// Clocks driven by a SceneTree frame signal register here instead of connecting
+// themselves: the hub holds a single connection per signal, samples the monotonic
+// clock once per frame and advances every registered clock in a plain loop.
+class TimeTickHub {
+public:
+	// SceneTree signal a clock is driven by
+	enum Frame {
+		FRAME_PHYSICS,
+		FRAME_PROCESS,
+		FRAME_MAX,
+	};
+
+	static void add_clock(TimeTick *clock, Frame frame);
+	static void remove_clock(TimeTick *clock, Frame frame);
+	static int get_clock_count(Frame frame);
+
+	// Drops the connections and releases the registries, called when the extension is unloaded
+	static void cleanup();
+
+private:
+	struct Driver {
+		// Registered clocks, in registration order. Entries removed while dispatching are left null
+		LocalVector<TimeTick *> clocks;
+		bool connected = false;
+		bool dispatching = false;
+		bool has_removed = false;
+	};
+
+	static Driver drivers[FRAME_MAX];
+
+	static void _on_physics_frame();
+	static void _on_process_frame();
+	static void _dispatch(Frame frame);
+	static void _compact(Frame frame);
+	static void _connect(Frame frame);
+	static void _disconnect(Frame frame);
+	static StringName _get_signal(Frame frame);
+	static Callable _get_callback(Frame frame);
+};
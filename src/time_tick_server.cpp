@@ -0,0 +1,493 @@
+// MIT License
+// Copyright (c) 2025 Lucas "Shoyguer" Melo
+
+#include "time_tick_server.hpp"
+#include "time_tick.hpp"
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+using namespace godot;
+
+
+TimeTickServer *TimeTickServer::singleton = nullptr;
+
+// Returns every RID an owner currently holds
+template <typename T>
+static LocalVector<RID> get_owned_rids(const RID_Owner<T> &owner) {
+	LocalVector<RID> rids;
+	rids.resize(owner.get_rid_count());
+	owner.fill_owned_buffer(rids.ptr());
+	return rids;
+}
+
+TimeTickServer *TimeTickServer::get_singleton() {
+	return singleton;
+}
+
+void TimeTickServer::set_singleton(TimeTickServer *server) {
+	singleton = server;
+}
+
+// Frees the clocks and calendars still alive at unload, reporting them like Godot's servers report leaked RIDs
+TimeTickServer::~TimeTickServer() {
+	LocalVector<RID> clocks = get_owned_rids(clock_owner);
+	if (!clocks.is_empty()) {
+		UtilityFunctions::push_warning(vformat("TimeTickServer: %d clocks were not freed with free_rid(), freeing them on exit", (int)clocks.size()));
+		for (uint32_t i = 0; i < clocks.size(); i++) {
+			free_rid(clocks[i]);
+		}
+	}
+	
+	// Clocks go first, a calendar can't be freed while it has clocks
+	LocalVector<RID> calendars = get_owned_rids(calendar_owner);
+	if (!calendars.is_empty()) {
+		UtilityFunctions::push_warning(vformat("TimeTickServer: %d calendars were not freed with free_rid(), freeing them on exit", (int)calendars.size()));
+		for (uint32_t i = 0; i < calendars.size(); i++) {
+			free_rid(calendars[i]);
+		}
+	}
+	
+	if (singleton == this) {
+		singleton = nullptr;
+	}
+}
+
+// Creates an empty calendar, units are added with calendar_add_unit/calendar_add_complex_unit
+RID TimeTickServer::calendar_create() {
+	Calendar calendar;
+	calendar.definition = new TimeUnitManager();
+	calendar.processor = new TimeUnitProcessor(calendar.definition);
+	// Server clocks have no signals, changes are applied without being reported
+	calendar.processor->set_reporting_changes(false);
+	return calendar_owner.make_rid(calendar);
+}
+
+// Adds a simple unit to a calendar (same parameters as TimeTick.register_time_unit)
+void TimeTickServer::calendar_add_unit(const RID &calendar, const StringName &unit_name, const StringName &tracked_unit, int trigger_count, int max_value, int min_value) {
+	Calendar *data = _get_editable_calendar(calendar);
+	if (!data) {
+		return;
+	}
+
+	if (unit_name == StringName()) {
+		UtilityFunctions::push_error("TimeTickServer: Unit name cannot be empty");
+		return;
+	}
+
+	if (trigger_count <= 0) {
+		UtilityFunctions::push_error("TimeTickServer: Trigger count must be positive");
+		return;
+	}
+
+	if (data->definition->would_create_cycle(unit_name, tracked_unit)) {
+		UtilityFunctions::push_error(vformat("TimeTickServer: Cannot add '%s' tracking '%s', it would create a dependency cycle", unit_name, tracked_unit));
+		return;
+	}
+
+	data->definition->register_simple_unit(unit_name, tracked_unit, trigger_count, max_value, min_value);
+}
+
+// Adds a complex unit to a calendar (same parameters as TimeTick.register_complex_time_unit)
+void TimeTickServer::calendar_add_complex_unit(const RID &calendar, const StringName &unit_name, const Dictionary &tracked_units, int max_value, int min_value) {
+	Calendar *data = _get_editable_calendar(calendar);
+	if (!data) {
+		return;
+	}
+
+	if (unit_name == StringName()) {
+		UtilityFunctions::push_error("TimeTickServer: Unit name cannot be empty");
+		return;
+	}
+
+	if (tracked_units.is_empty()) {
+		UtilityFunctions::push_error("TimeTickServer: Complex time unit must track at least one unit");
+		return;
+	}
+
+	// Validate that all tracked units exist
+	Array keys = tracked_units.keys();
+	for (int i = 0; i < keys.size(); i++) {
+		String tracked_unit = keys[i];
+		if (!data->definition->has_unit(StringName(tracked_unit)) && tracked_unit != "tick") {
+			UtilityFunctions::push_warning(vformat("TimeTickServer: Tracked unit '%s' not yet registered, make sure to register it first", tracked_unit));
+		}
+	}
+
+	if (data->definition->would_create_cycle(unit_name, tracked_units)) {
+		UtilityFunctions::push_error(vformat("TimeTickServer: Cannot add complex unit '%s', its tracked units would create a dependency cycle", unit_name));
+		return;
+	}
+
+	data->definition->register_complex_unit(unit_name, tracked_units, max_value, min_value);
+}
+
+// Sets how much a unit of a calendar increases each time it triggers
+void TimeTickServer::calendar_set_unit_step(const RID &calendar, const StringName &unit_name, int step_amount) {
+	Calendar *data = _get_editable_calendar(calendar);
+	if (!data) {
+		return;
+	}
+
+	if (!data->definition->has_unit(unit_name)) {
+		UtilityFunctions::push_error(vformat("TimeTickServer: Time unit '%s' does not exist", unit_name));
+		return;
+	}
+	data->definition->set_step(unit_name, step_amount);
+}
+
+// Returns the id used to query a unit on the clocks of a calendar, or -1 if the unit doesn't exist
+int TimeTickServer::calendar_get_unit_id(const RID &calendar, const StringName &unit_name) const {
+	Calendar *data = calendar_owner.get_or_null(calendar);
+	if (!data) {
+		UtilityFunctions::push_error("TimeTickServer: Invalid calendar RID");
+		return -1;
+	}
+	return data->definition->find_unit_id(unit_name);
+}
+
+// Returns how many clocks use a calendar
+int TimeTickServer::calendar_get_clock_count(const RID &calendar) const {
+	Calendar *data = calendar_owner.get_or_null(calendar);
+	if (!data) {
+		UtilityFunctions::push_error("TimeTickServer: Invalid calendar RID");
+		return 0;
+	}
+	return data->clocks.size();
+}
+
+// Creates a clock on a calendar, every unit starts at its minimum value
+// The calendar can't be changed anymore once it has clocks
+RID TimeTickServer::clock_create(const RID &calendar) {
+	Calendar *data = calendar_owner.get_or_null(calendar);
+	if (!data) {
+		UtilityFunctions::push_error("TimeTickServer: Invalid calendar RID");
+		return RID();
+	}
+
+	Clock clock;
+	clock.calendar = calendar;
+	clock.calendar_slot = data->clocks.size();
+	data->definition->init_state(clock.state);
+
+	RID rid = clock_owner.make_rid(clock);
+	data->clocks.push_back(rid);
+	return rid;
+}
+
+// Moves a clock forward (or backward for negative values) by a number of ticks in one step
+void TimeTickServer::clock_advance(const RID &clock, int64_t ticks) {
+	Clock *data = clock_owner.get_or_null(clock);
+	if (!data) {
+		UtilityFunctions::push_error("TimeTickServer: Invalid clock RID");
+		return;
+	}
+	_advance_clock(calendar_owner.get_or_null(data->calendar), data, ticks);
+}
+
+// Pauses or resumes a clock, paused clocks are skipped by advance_calendar_clocks
+void TimeTickServer::clock_set_paused(const RID &clock, bool paused) {
+	Clock *data = clock_owner.get_or_null(clock);
+	if (!data) {
+		UtilityFunctions::push_error("TimeTickServer: Invalid clock RID");
+		return;
+	}
+	data->paused = paused;
+}
+
+// Returns true if the clock is paused
+bool TimeTickServer::clock_is_paused(const RID &clock) const {
+	Clock *data = clock_owner.get_or_null(clock);
+	return data ? data->paused : false;
+}
+
+// Returns the tick count of a clock
+int TimeTickServer::clock_get_tick(const RID &clock) const {
+	Clock *data = clock_owner.get_or_null(clock);
+	return data ? data->current_tick : 0;
+}
+
+// Returns the value of a unit on a clock (ids come from calendar_get_unit_id)
+int TimeTickServer::clock_get_unit(const RID &clock, int unit_id) const {
+	Clock *data = clock_owner.get_or_null(clock);
+	if (!data) {
+		return 0;
+	}
+	int index = calendar_owner.get_or_null(data->calendar)->definition->resolve_unit_id(unit_id);
+	return index >= 0 ? data->state.values[index] : 0;
+}
+
+// Sets the value of a unit on a clock (ids come from calendar_get_unit_id)
+void TimeTickServer::clock_set_unit(const RID &clock, int unit_id, int value) {
+	Clock *data = clock_owner.get_or_null(clock);
+	if (!data) {
+		UtilityFunctions::push_error("TimeTickServer: Invalid clock RID");
+		return;
+	}
+	Calendar *calendar = calendar_owner.get_or_null(data->calendar);
+	int index = calendar->definition->resolve_unit_id(unit_id);
+	if (index < 0) {
+		UtilityFunctions::push_error(vformat("TimeTickServer: Invalid unit id %d", unit_id));
+		return;
+	}
+	data->state.values[index] = value;
+	// Same counters as TimeTick.set_time_unit, so both kinds of clock move on identically
+	calendar->definition->seed_counters(data->state, data->current_tick);
+}
+
+// Returns every unit value of a clock, indexed by unit slot (the low bits of a unit id)
+PackedInt32Array TimeTickServer::clock_get_units(const RID &clock) const {
+	PackedInt32Array result;
+	Clock *data = clock_owner.get_or_null(clock);
+	if (!data) {
+		return result;
+	}
+
+	result.resize(data->state.values.size());
+	int32_t *values = result.ptrw();
+	for (uint32_t i = 0; i < data->state.values.size(); i++) {
+		values[i] = data->state.values[i];
+	}
+	return result;
+}
+
+// Advances every unpaused clock of a calendar by the same number of ticks
+// The clocks share the calendar's plan, only their state is swapped into a processor
+// Large calendars are split across worker tasks, each with its own processor and range of clocks
+void TimeTickServer::advance_calendar_clocks(const RID &calendar, int64_t ticks) {
+	Calendar *data = calendar_owner.get_or_null(calendar);
+	if (!data) {
+		UtilityFunctions::push_error("TimeTickServer: Invalid calendar RID");
+		return;
+	}
+	if (ticks == 0) {
+		return;
+	}
+
+	// Clocks are resolved up front, worker tasks don't touch the RID owners
+	batch_clocks.clear();
+	for (uint32_t i = 0; i < data->clocks.size(); i++) {
+		Clock *clock = clock_owner.get_or_null(data->clocks[i]);
+		if (clock && !clock->paused) {
+			batch_clocks.push_back(clock);
+		}
+	}
+
+	uint32_t task_count = _get_task_count(batch_clocks.size());
+	if (task_count <= 1) {
+		for (uint32_t i = 0; i < batch_clocks.size(); i++) {
+			_advance_clock(data, batch_clocks[i], ticks);
+		}
+		batch_clocks.clear();
+		return;
+	}
+
+	while (data->task_processors.size() < task_count) {
+		TimeUnitProcessor *processor = new TimeUnitProcessor(data->definition);
+		processor->set_reporting_changes(false);
+		data->task_processors.push_back(processor);
+	}
+
+	batch_calendar = data;
+	batch_ticks = ticks;
+	batch_task_count = task_count;
+	_run_tasks(callable_mp(this, &TimeTickServer::_advance_clocks_task), task_count);
+	batch_calendar = nullptr;
+	batch_clocks.clear();
+}
+
+// Advances many TimeTicks by the same number of ticks, like calling advance_ticks on each
+// Cascades run on worker tasks with their changes buffered per clock, then every clock's
+// signals are emitted on this thread, clock by clock in array order
+void TimeTickServer::advance_time_ticks(const TypedArray<TimeTick> &time_ticks, int64_t ticks) {
+	if (ticks == 0) {
+		return;
+	}
+
+	batch_time_ticks.clear();
+	for (int64_t i = 0; i < time_ticks.size(); i++) {
+		TimeTick *time_tick = Object::cast_to<TimeTick>(time_ticks[i]);
+		// A clock listed twice is only advanced once, two tasks can't share it
+		if (!time_tick || time_tick->in_batch) {
+			continue;
+		}
+		if (!time_tick->processor) {
+			UtilityFunctions::push_error("TimeTickServer: Cannot advance a TimeTick before its initialize() is called");
+			continue;
+		}
+		time_tick->in_batch = true;
+		time_tick->processor->defer_changes();
+		batch_time_ticks.push_back(time_tick);
+	}
+	batch_applied_ticks.resize(batch_time_ticks.size());
+	batch_ticks = ticks;
+
+	uint32_t task_count = _get_task_count(batch_time_ticks.size());
+	batch_task_count = task_count;
+	if (task_count <= 1) {
+		_advance_time_ticks_task(0);
+	} else {
+		_run_tasks(callable_mp(this, &TimeTickServer::_advance_time_ticks_task), task_count);
+	}
+
+	// Copied first, a signal handler may start another batch
+	LocalVector<TimeTick *> advanced = batch_time_ticks;
+	LocalVector<int64_t> applied = batch_applied_ticks;
+	batch_time_ticks.clear();
+
+	for (uint32_t i = 0; i < advanced.size(); i++) {
+		TimeTick *time_tick = advanced[i];
+		time_tick->in_batch = false;
+		time_tick->processor->flush_deferred_changes();
+		if (applied[i] != 0) {
+			time_tick->_emit_ticks_advanced(applied[i]);
+		}
+	}
+}
+
+// Frees a clock or a calendar, a calendar can only be freed once all its clocks are
+void TimeTickServer::free_rid(const RID &rid) {
+	if (Clock *clock = clock_owner.get_or_null(rid)) {
+		// Swap-remove the clock from its calendar's list
+		Calendar *calendar = calendar_owner.get_or_null(clock->calendar);
+		if (calendar) {
+			uint32_t slot = clock->calendar_slot;
+			uint32_t last = calendar->clocks.size() - 1;
+			if (slot != last) {
+				RID moved = calendar->clocks[last];
+				calendar->clocks[slot] = moved;
+				clock_owner.get_or_null(moved)->calendar_slot = slot;
+			}
+			calendar->clocks.resize(last);
+		}
+		clock_owner.free(rid);
+		return;
+	}
+
+	if (Calendar *calendar = calendar_owner.get_or_null(rid)) {
+		if (!calendar->clocks.is_empty()) {
+			UtilityFunctions::push_error(vformat("TimeTickServer: Cannot free a calendar that still has %d clocks", (int)calendar->clocks.size()));
+			return;
+		}
+		for (uint32_t i = 0; i < calendar->task_processors.size(); i++) {
+			delete calendar->task_processors[i];
+		}
+		delete calendar->processor;
+		delete calendar->definition;
+		calendar_owner.free(rid);
+		return;
+	}
+
+	UtilityFunctions::push_error("TimeTickServer: Invalid RID");
+}
+
+// Returns a calendar that can still be changed, or null (with an error) if the RID is invalid or it has clocks
+TimeTickServer::Calendar *TimeTickServer::_get_editable_calendar(const RID &calendar) {
+	Calendar *data = calendar_owner.get_or_null(calendar);
+	if (!data) {
+		UtilityFunctions::push_error("TimeTickServer: Invalid calendar RID");
+		return nullptr;
+	}
+	if (!data->clocks.is_empty()) {
+		UtilityFunctions::push_error("TimeTickServer: Cannot change a calendar that already has clocks");
+		return nullptr;
+	}
+	return data;
+}
+
+// Runs the calendar's processor on a clock's state
+void TimeTickServer::_advance_clock(Calendar *calendar, Clock *clock, int64_t ticks) {
+	if (!calendar || ticks == 0) {
+		return;
+	}
+
+	TimeUnitProcessor *processor = calendar->processor;
+	processor->set_state(&clock->state);
+	_run_clock(processor, clock, ticks);
+	processor->set_state(&calendar->definition->get_state());
+}
+
+// Moves a clock's tick and runs the cascade on a processor already set to the clock's state
+// Tick count handling matches TimeTick.advance_ticks: wraps after INT_MAX, stops at 0 when rewinding
+void TimeTickServer::_run_clock(TimeUnitProcessor *processor, Clock *clock, int64_t ticks) {
+	if (ticks > 0) {
+		clock->current_tick = (int)(((int64_t)clock->current_tick + ticks % ((int64_t)INT_MAX + 1)) % ((int64_t)INT_MAX + 1));
+		processor->set_current_tick(clock->current_tick);
+		processor->advance_forward(ticks);
+	} else {
+		int64_t rewind = ticks < -(int64_t)clock->current_tick ? (int64_t)clock->current_tick : -ticks;
+		if (rewind > 0) {
+			clock->current_tick -= (int)rewind;
+			processor->set_current_tick(clock->current_tick);
+			processor->advance_backward(rewind);
+		}
+	}
+}
+
+// Returns how many worker tasks a batch is split into, 1 when it's too small to be worth it
+uint32_t TimeTickServer::_get_task_count(uint32_t clock_count) {
+	uint32_t max_tasks = clock_count / MIN_CLOCKS_PER_TASK;
+	uint32_t thread_count = (uint32_t)MAX(OS::get_singleton()->get_processor_count(), 1);
+	return MAX(MIN(max_tasks, thread_count), 1u);
+}
+
+// Returns the range [r_begin, r_end) of a batch handled by a task, ranges differ by at most one item
+void TimeTickServer::_get_task_range(uint32_t task, uint32_t task_count, uint32_t item_count, uint32_t &r_begin, uint32_t &r_end) {
+	r_begin = (uint32_t)((uint64_t)task * item_count / task_count);
+	r_end = (uint32_t)((uint64_t)(task + 1) * item_count / task_count);
+}
+
+// Runs one call of the task per index on the WorkerThreadPool and waits for all of them
+void TimeTickServer::_run_tasks(const Callable &task, uint32_t task_count) {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	int64_t group_id = pool->add_group_task(task, task_count, task_count, true, "TimeTickServer batch advance");
+	pool->wait_for_group_task_completion(group_id);
+}
+
+// Worker task of advance_calendar_clocks, runs its own processor on its range of clocks
+void TimeTickServer::_advance_clocks_task(uint32_t task) {
+	uint32_t begin;
+	uint32_t end;
+	_get_task_range(task, batch_task_count, batch_clocks.size(), begin, end);
+
+	TimeUnitProcessor *processor = batch_calendar->task_processors[task];
+	for (uint32_t i = begin; i < end; i++) {
+		processor->set_state(&batch_clocks[i]->state);
+		_run_clock(processor, batch_clocks[i], batch_ticks);
+	}
+	processor->set_state(&batch_calendar->definition->get_state());
+}
+
+// Worker task of advance_time_ticks, each TimeTick runs its own processor with its changes deferred
+void TimeTickServer::_advance_time_ticks_task(uint32_t task) {
+	uint32_t begin;
+	uint32_t end;
+	_get_task_range(task, batch_task_count, batch_time_ticks.size(), begin, end);
+
+	for (uint32_t i = begin; i < end; i++) {
+		batch_applied_ticks[i] = batch_time_ticks[i]->_apply_ticks(batch_ticks);
+	}
+}
+
+void TimeTickServer::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("calendar_create"), &TimeTickServer::calendar_create);
+	ClassDB::bind_method(D_METHOD("calendar_add_unit", "calendar", "unit_name", "tracked_unit", "trigger_count", "max_value", "min_value"),
+		&TimeTickServer::calendar_add_unit, DEFVAL(1), DEFVAL(-1), DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("calendar_add_complex_unit", "calendar", "unit_name", "tracked_units", "max_value", "min_value"),
+		&TimeTickServer::calendar_add_complex_unit, DEFVAL(-1), DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("calendar_set_unit_step", "calendar", "unit_name", "step_amount"), &TimeTickServer::calendar_set_unit_step);
+	ClassDB::bind_method(D_METHOD("calendar_get_unit_id", "calendar", "unit_name"), &TimeTickServer::calendar_get_unit_id);
+	ClassDB::bind_method(D_METHOD("calendar_get_clock_count", "calendar"), &TimeTickServer::calendar_get_clock_count);
+	ClassDB::bind_method(D_METHOD("clock_create", "calendar"), &TimeTickServer::clock_create);
+	ClassDB::bind_method(D_METHOD("clock_advance", "clock", "ticks"), &TimeTickServer::clock_advance);
+	ClassDB::bind_method(D_METHOD("clock_set_paused", "clock", "paused"), &TimeTickServer::clock_set_paused);
+	ClassDB::bind_method(D_METHOD("clock_is_paused", "clock"), &TimeTickServer::clock_is_paused);
+	ClassDB::bind_method(D_METHOD("clock_get_tick", "clock"), &TimeTickServer::clock_get_tick);
+	ClassDB::bind_method(D_METHOD("clock_get_unit", "clock", "unit_id"), &TimeTickServer::clock_get_unit);
+	ClassDB::bind_method(D_METHOD("clock_set_unit", "clock", "unit_id", "value"), &TimeTickServer::clock_set_unit);
+	ClassDB::bind_method(D_METHOD("clock_get_units", "clock"), &TimeTickServer::clock_get_units);
+	ClassDB::bind_method(D_METHOD("advance_calendar_clocks", "calendar", "ticks"), &TimeTickServer::advance_calendar_clocks);
+	ClassDB::bind_method(D_METHOD("advance_time_ticks", "time_ticks", "ticks"), &TimeTickServer::advance_time_ticks);
+	ClassDB::bind_method(D_METHOD("free_rid", "rid"), &TimeTickServer::free_rid);
+}
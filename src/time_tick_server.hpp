@@ -0,0 +1,112 @@
+// MIT License
+// Copyright (c) 2025 Lucas "Shoyguer" Melo
+
+#pragma once
+
+#include <godot_cpp/core/object.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/templates/rid_owner.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/rid.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
+
+// Helper classes
+#include "time_unit_manager.hpp"
+#include "time_unit_processor.hpp"
+
+using namespace godot;
+
+class TimeTick;
+
+// Server-style API for large numbers of lightweight clocks
+//
+// A calendar is a unit hierarchy registered once. A clock only stores its tick and
+// the values, counters and trigger latches of its calendar's units, and shares the
+// calendar's definition and processor with every other clock on that calendar.
+// Both are RIDs: no objects, no signals and no frame connections per clock.
+//
+// Bulk advances split large batches across the WorkerThreadPool. Each task runs
+// its own processor on its own range of clocks, and signals of TimeTick batches
+// are emitted on the calling thread once every task is done.
+class TimeTickServer : public Object {
+	GDCLASS(TimeTickServer, Object)
+
+public:
+	static TimeTickServer *get_singleton();
+	// Only called by the module initializer, scripts can't create their own server
+	static void set_singleton(TimeTickServer *server);
+
+	TimeTickServer() = default;
+	~TimeTickServer();
+
+	// Calendars (shared unit definitions)
+	RID calendar_create();
+	void calendar_add_unit(const RID &calendar, const StringName &unit_name, const StringName &tracked_unit, int trigger_count = 1, int max_value = -1, int min_value = 0);
+	void calendar_add_complex_unit(const RID &calendar, const StringName &unit_name, const Dictionary &tracked_units, int max_value = -1, int min_value = 0);
+	void calendar_set_unit_step(const RID &calendar, const StringName &unit_name, int step_amount);
+	int calendar_get_unit_id(const RID &calendar, const StringName &unit_name) const;
+	int calendar_get_clock_count(const RID &calendar) const;
+
+	// Clocks (per-entity state)
+	RID clock_create(const RID &calendar);
+	void clock_advance(const RID &clock, int64_t ticks);
+	void clock_set_paused(const RID &clock, bool paused);
+	bool clock_is_paused(const RID &clock) const;
+	int clock_get_tick(const RID &clock) const;
+	int clock_get_unit(const RID &clock, int unit_id) const;
+	void clock_set_unit(const RID &clock, int unit_id, int value);
+	PackedInt32Array clock_get_units(const RID &clock) const;
+
+	// Bulk operations
+	void advance_calendar_clocks(const RID &calendar, int64_t ticks);
+	void advance_time_ticks(const TypedArray<TimeTick> &time_ticks, int64_t ticks);
+
+	void free_rid(const RID &rid);
+
+protected:
+	static void _bind_methods();
+
+private:
+	struct Calendar {
+		TimeUnitManager *definition = nullptr;
+		TimeUnitProcessor *processor = nullptr;
+		// One processor per worker task of a parallel advance, created on first use
+		LocalVector<TimeUnitProcessor *> task_processors;
+		// Clocks using this calendar, a clock stores its position for constant-time removal
+		LocalVector<RID> clocks;
+	};
+
+	struct Clock {
+		RID calendar;
+		uint32_t calendar_slot = 0;
+		int current_tick = 0;
+		bool paused = false;
+		TimeUnitState state;
+	};
+
+	// Batches are only split across worker tasks when every task gets at least this many clocks
+	static constexpr uint32_t MIN_CLOCKS_PER_TASK = 256;
+
+	static TimeTickServer *singleton;
+
+	mutable RID_Owner<Calendar> calendar_owner;
+	mutable RID_Owner<Clock> clock_owner;
+
+	// Batch being advanced, read by the worker tasks (each task only touches its own range)
+	Calendar *batch_calendar = nullptr;
+	LocalVector<Clock *> batch_clocks;
+	LocalVector<TimeTick *> batch_time_ticks;
+	LocalVector<int64_t> batch_applied_ticks;
+	int64_t batch_ticks = 0;
+	uint32_t batch_task_count = 0;
+
+	Calendar *_get_editable_calendar(const RID &calendar);
+	void _advance_clock(Calendar *calendar, Clock *clock, int64_t ticks);
+	static void _run_clock(TimeUnitProcessor *processor, Clock *clock, int64_t ticks);
+	static uint32_t _get_task_count(uint32_t clock_count);
+	static void _get_task_range(uint32_t task, uint32_t task_count, uint32_t item_count, uint32_t &r_begin, uint32_t &r_end);
+	void _run_tasks(const Callable &task, uint32_t task_count);
+	void _advance_clocks_task(uint32_t task);
+	void _advance_time_ticks_task(uint32_t task);
+};
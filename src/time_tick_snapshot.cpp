@@ -0,0 +1,107 @@
+// MIT License
+// Copyright (c) 2025 Lucas "Shoyguer" Melo
+
+#include "time_tick_snapshot.hpp"
+
+using namespace godot;
+
+
+TimeTickSnapshot::~TimeTickSnapshot() {
+	for (uint32_t i = 0; i < buffers.size(); i++) {
+		delete[] buffers[i]->values;
+		delete buffers[i];
+	}
+}
+
+// Copies the tick and unit values, readers see either all of the previous copy or all of this one
+void TimeTickSnapshot::publish(int p_tick, const LocalVector<int> &values) {
+	uint32_t count = values.size();
+	Buffer *current = buffer.load(std::memory_order_relaxed);
+	if (!current || current->capacity < count) {
+		// Readers may still be reading the old buffer, it's kept until the snapshot is released
+		current = new Buffer;
+		current->capacity = MAX(count * 2, 8u);
+		current->values = new std::atomic<int>[current->capacity];
+		for (uint32_t i = 0; i < current->capacity; i++) {
+			current->values[i].store(0, std::memory_order_relaxed);
+		}
+		buffers.push_back(current);
+	}
+
+	uint32_t start = sequence.load(std::memory_order_relaxed);
+	sequence.store(start + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	tick.store(p_tick, std::memory_order_relaxed);
+	size.store(count, std::memory_order_relaxed);
+	buffer.store(current, std::memory_order_relaxed);
+	for (uint32_t i = 0; i < count; i++) {
+		current->values[i].store(values[i], std::memory_order_relaxed);
+	}
+
+	sequence.store(start + 2, std::memory_order_release);
+}
+
+// Returns the published tick count
+int TimeTickSnapshot::read_tick() const {
+	while (true) {
+		uint32_t start = _begin_read();
+		int value = tick.load(std::memory_order_relaxed);
+		if (_end_read(start)) {
+			return value;
+		}
+	}
+}
+
+// Returns one published unit value, or 0 if the id is out of range
+int TimeTickSnapshot::read_value(int index) const {
+	while (true) {
+		uint32_t start = _begin_read();
+		const Buffer *current = buffer.load(std::memory_order_relaxed);
+		// The size may belong to a newer buffer than the pointer, never read past the buffer's capacity
+		uint32_t count = current ? MIN(size.load(std::memory_order_relaxed), current->capacity) : 0;
+		int value = (index >= 0 && (uint32_t)index < count) ? current->values[index].load(std::memory_order_relaxed) : 0;
+		if (_end_read(start)) {
+			return value;
+		}
+	}
+}
+
+// Returns every published unit value, indexed by unit id, all from the same publish
+// r_tick, if given, receives the tick count of that same publish
+PackedInt32Array TimeTickSnapshot::read_values(int *r_tick) const {
+	PackedInt32Array result;
+	while (true) {
+		uint32_t start = _begin_read();
+		int published_tick = tick.load(std::memory_order_relaxed);
+		const Buffer *current = buffer.load(std::memory_order_relaxed);
+		uint32_t count = current ? MIN(size.load(std::memory_order_relaxed), current->capacity) : 0;
+		result.resize(count);
+		int32_t *values = result.ptrw();
+		for (uint32_t i = 0; i < count; i++) {
+			values[i] = current->values[i].load(std::memory_order_relaxed);
+		}
+		if (_end_read(start)) {
+			if (r_tick) {
+				*r_tick = published_tick;
+			}
+			return result;
+		}
+	}
+}
+
+// Waits out a publish in progress and returns the sequence the read starts at
+uint32_t TimeTickSnapshot::_begin_read() const {
+	while (true) {
+		uint32_t start = sequence.load(std::memory_order_acquire);
+		if ((start & 1) == 0) {
+			return start;
+		}
+	}
+}
+
+// Returns true if nothing was published while reading, otherwise the read must be retried
+bool TimeTickSnapshot::_end_read(uint32_t start) const {
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return sequence.load(std::memory_order_relaxed) == start;
+}
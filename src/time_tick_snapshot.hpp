@@ -0,0 +1,49 @@
+// MIT License
+// Copyright (c) 2025 Lucas "Shoyguer" Melo
+
+#pragma once
+
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+
+#include <atomic>
+
+using namespace godot;
+
+// Internal helper class holding a copy of a clock's tick and unit values for other threads
+// This is NOT exposed to Godot. This is just for internal organization.
+//
+// A sequence lock: one thread publishes, any number of threads read without locking.
+// The sequence is odd while a publish is in progress, readers retry until they read
+// the same even sequence before and after copying, so they never see half a cascade.
+// Buffers are replaced when the unit table grows but only released with the snapshot,
+// a reader still holding an old one reads stale values and retries.
+class TimeTickSnapshot {
+public:
+	TimeTickSnapshot() = default;
+	~TimeTickSnapshot();
+
+	// Writer side, only ever called from one thread at a time
+	void publish(int tick, const LocalVector<int> &values);
+
+	// Reader side, safe from any thread
+	int read_tick() const;
+	int read_value(int index) const;
+	PackedInt32Array read_values(int *r_tick = nullptr) const;
+
+private:
+	struct Buffer {
+		std::atomic<int> *values = nullptr;
+		uint32_t capacity = 0;
+	};
+
+	std::atomic<uint32_t> sequence{ 0 };
+	std::atomic<int> tick{ 0 };
+	std::atomic<uint32_t> size{ 0 };
+	std::atomic<Buffer *> buffer{ nullptr };
+	// Every buffer ever published, released in the destructor
+	LocalVector<Buffer *> buffers;
+
+	uint32_t _begin_read() const;
+	bool _end_read(uint32_t start) const;
+};
@@ -8,215 +8,669 @@ using namespace godot;
 
 
 // Registers a simple time unit that tracks another unit
-void TimeUnitManager::register_simple_unit(const String &name, const String &tracked_unit, int trigger_count, int max_value, int min_value) {
-	Dictionary unit;
-	unit["name"] = name;
-	unit["current_value"] = min_value;
-	unit["tracked_unit"] = tracked_unit;
-	unit["trigger_count"] = trigger_count;
-	unit["step_amount"] = 1;
-	unit["max_value"] = max_value;
-	unit["min_value"] = min_value;
-	units[name] = unit;
-	
-	init_counter(name);
+void TimeUnitManager::register_simple_unit(const StringName &name, const StringName &tracked_unit, int trigger_count, int max_value, int min_value) {
+	bool existed = name_to_index.has(name);
+	int index = allocate_slot(name);
+	if (index < 0) {
+		return;
+	}
+
+	tracked_names[index] = tracked_unit;
+	state.values[index] = min_value;
+	steps[index] = 1;
+	trigger_counts[index] = trigger_count;
+	min_values[index] = min_value;
+	max_values[index] = max_value;
+	complex_flags[index] = 0;
+	state.set_triggered(index, false);
+	tracked_units[index] = Dictionary();
+
+	// Keep the accumulated counter when a unit is registered again
+	if (!existed) {
+		state.counters[index] = 0;
+	}
+
+	relink();
 }
 
 // Registers a complex time unit that tracks multiple units with specific values
-void TimeUnitManager::register_complex_unit(const String &name, const Dictionary &tracked_units, int max_value, int min_value) {
-	Dictionary unit;
-	unit["name"] = name;
-	unit["current_value"] = min_value;
-	unit["is_complex"] = true;
-	unit["tracked_units"] = tracked_units;
-	unit["step_amount"] = 1;
-	unit["max_value"] = max_value;
-	unit["min_value"] = min_value;
-	units[name] = unit;
+void TimeUnitManager::register_complex_unit(const StringName &name, const Dictionary &p_tracked_units, int max_value, int min_value) {
+	int index = allocate_slot(name);
+	if (index < 0) {
+		return;
+	}
+
+	tracked_names[index] = StringName();
+	state.values[index] = min_value;
+	state.counters[index] = 0;
+	steps[index] = 1;
+	trigger_counts[index] = 1;
+	min_values[index] = min_value;
+	max_values[index] = max_value;
+	complex_flags[index] = 1;
+	state.set_triggered(index, false);
+	tracked_units[index] = p_tracked_units;
+
+	relink();
 }
 
 // Removes a time unit from the system
-void TimeUnitManager::unregister_unit(const String &name) {
-	units.erase(name);
-	counters.erase(name);
+void TimeUnitManager::unregister_unit(const StringName &name) {
+	const int *index_ptr = name_to_index.getptr(name);
+	if (!index_ptr) {
+		return;
+	}
+	int index = *index_ptr;
+
+	name_to_index.erase(name);
+	order.erase(index);
+	free_slots.push_back(index);
+	generations[index] = (generations[index] + 1) & UNIT_ID_GENERATION_MASK;
+
+	// Release slot data so references held by the slot don't linger
+	names[index] = StringName();
+	tracked_names[index] = StringName();
+	tracked_units[index] = Dictionary();
+	state.clear_listeners(index);
+	parents[index] = INVALID_INDEX;
+	state.set_triggered(index, false);
+
+	relink();
 }
 
 // Returns true if the unit exists in the system
-bool TimeUnitManager::has_unit(const String &name) const {
-	return units.has(name);
+bool TimeUnitManager::has_unit(const StringName &name) const {
+	return name_to_index.has(name);
 }
 
 // Returns the complete data dictionary for a unit
-Dictionary TimeUnitManager::get_unit(const String &name) const {
-	if (units.has(name)) {
-		return units[name];
+// Built on demand, the unit table itself doesn't store dictionaries
+Dictionary TimeUnitManager::get_unit(const StringName &name) const {
+	int index = find_index(name);
+	if (index < 0) {
+		return Dictionary();
 	}
-	return Dictionary();
-}
 
-// Returns the current value of a time unit
-int TimeUnitManager::get_value(const String &name) const {
-	if (units.has(name)) {
-		Dictionary unit = units[name];
-		return unit["current_value"];
+	Dictionary unit;
+	unit["name"] = names[index];
+	unit["current_value"] = state.values[index];
+	if (complex_flags[index]) {
+		unit["is_complex"] = true;
+		unit["tracked_units"] = tracked_units[index];
+	} else {
+		unit["tracked_unit"] = tracked_names[index];
+		unit["trigger_count"] = trigger_counts[index];
 	}
-	return 0;
+	unit["step_amount"] = steps[index];
+	unit["max_value"] = max_values[index];
+	unit["min_value"] = min_values[index];
+	return unit;
 }
 
 // Returns an array of all registered time unit names
 TypedArray<String> TimeUnitManager::get_all_names() const {
-	TypedArray<String> names;
-	Array keys = units.keys();
-	for (int i = 0; i < keys.size(); i++) {
-		names.append(keys[i]);
-	}
-	return names;
-}
-
-// Sets the current value of a time unit
-void TimeUnitManager::set_value(const String &name, int value) {
-	if (units.has(name)) {
-		Dictionary unit = units[name];
-		unit["current_value"] = value;
-		units[name] = unit;
+	TypedArray<String> result;
+	for (uint32_t i = 0; i < order.size(); i++) {
+		result.append(String(names[order[i]]));
 	}
+	return result;
 }
 
 // Sets the step amount for a time unit (how much it increments)
-void TimeUnitManager::set_step(const String &name, int step) {
-	if (units.has(name)) {
-		Dictionary unit = units[name];
-		unit["step_amount"] = step;
-		units[name] = unit;
+void TimeUnitManager::set_step(const StringName &name, int step) {
+	int index = find_index(name);
+	if (index >= 0) {
+		steps[index] = step;
 	}
 }
 
 // Sets how many times the tracked unit must increment to trigger this unit
-void TimeUnitManager::set_trigger_count(const String &name, int count) {
-	if (units.has(name)) {
-		Dictionary unit = units[name];
-		unit["trigger_count"] = count;
-		units[name] = unit;
+void TimeUnitManager::set_trigger_count(const StringName &name, int count) {
+	int index = find_index(name);
+	if (index >= 0) {
+		trigger_counts[index] = count;
 	}
 }
 
 // Sets the minimum value for a time unit
-void TimeUnitManager::set_min_value(const String &name, int min_val) {
-	if (units.has(name)) {
-		Dictionary unit = units[name];
-		unit["min_value"] = min_val;
-		units[name] = unit;
+void TimeUnitManager::set_min_value(const StringName &name, int min_val) {
+	int index = find_index(name);
+	if (index >= 0) {
+		min_values[index] = min_val;
 	}
 }
 
 // Returns true if the unit is a complex unit (tracks multiple units)
-bool TimeUnitManager::is_complex(const String &name) const {
-	if (units.has(name)) {
-		Dictionary unit = units[name];
-		return unit.has("is_complex") && (bool)unit["is_complex"];
+bool TimeUnitManager::is_complex(const StringName &name) const {
+	int index = find_index(name);
+	return index >= 0 && complex_flags[index];
+}
+
+// Returns the step amount for a time unit
+int TimeUnitManager::get_step(const StringName &name) const {
+	int index = find_index(name);
+	return index >= 0 ? steps[index] : 1;
+}
+
+// Returns the trigger count for a simple time unit
+int TimeUnitManager::get_trigger_count(const StringName &name) const {
+	int index = find_index(name);
+	return index >= 0 ? trigger_counts[index] : 1;
+}
+
+// Returns the minimum value for a time unit
+int TimeUnitManager::get_min_value(const StringName &name) const {
+	int index = find_index(name);
+	return index >= 0 ? min_values[index] : 0;
+}
+
+// Returns the maximum value for a time unit (-1 means no max)
+int TimeUnitManager::get_max_value(const StringName &name) const {
+	int index = find_index(name);
+	return index >= 0 ? max_values[index] : -1;
+}
+
+// Returns the dictionary of tracked units for a complex unit
+Dictionary TimeUnitManager::get_tracked_units(const StringName &name) const {
+	int index = find_index(name);
+	return index >= 0 ? tracked_units[index] : Dictionary();
+}
+
+// Clears all registered units and counters
+void TimeUnitManager::clear() {
+	name_to_index.clear();
+	order.clear();
+	free_slots.clear();
+	// Slots are handed out again from 0, ids from before the clear must not match them
+	for (uint32_t i = 0; i < generations.size(); i++) {
+		generations[i] = (generations[i] + 1) & UNIT_ID_GENERATION_MASK;
+	}
+
+	names.clear();
+	tracked_names.clear();
+	parents.clear();
+	children.clear();
+	tick_children.clear();
+	complex_dependents.clear();
+	tick_complex_dependents.clear();
+	state.clear();
+	steps.clear();
+	trigger_counts.clear();
+	min_values.clear();
+	max_values.clear();
+	complex_flags.clear();
+
+	tracked_units.clear();
+	condition_begins.clear();
+	condition_counts.clear();
+	condition_units.clear();
+	condition_values.clear();
+	plan.clear();
+	level_begins.clear();
+	levels.clear();
+}
+
+// Returns true if registering a simple unit with this tracked unit would close a dependency cycle
+bool TimeUnitManager::would_create_cycle(const StringName &name, const StringName &tracked_unit) const {
+	if (tracked_unit == name) {
+		return true;
+	}
+	return reaches(name, resolve_index(tracked_unit));
+}
+
+// Returns true if registering a complex unit with these tracked units would close a dependency cycle
+bool TimeUnitManager::would_create_cycle(const StringName &name, const Dictionary &p_tracked_units) const {
+	Array keys = p_tracked_units.keys();
+	for (int i = 0; i < keys.size(); i++) {
+		if (would_create_cycle(name, StringName(keys[i]))) {
+			return true;
+		}
 	}
 	return false;
 }
 
-// Returns the step amount for a time unit
-int TimeUnitManager::get_step(const String &name) const {
-	if (units.has(name)) {
-		Dictionary unit = units[name];
-		return unit.has("step_amount") ? (int)unit["step_amount"] : 1;
+// Returns the slot index of a registered unit, or INVALID_INDEX
+int TimeUnitManager::find_index(const StringName &name) const {
+	const int *index = name_to_index.getptr(name);
+	return index ? *index : INVALID_INDEX;
+}
+
+// Returns the id of a registered unit, or -1
+int TimeUnitManager::find_unit_id(const StringName &name) const {
+	int index = find_index(name);
+	return index >= 0 ? get_unit_id_at(index) : -1;
+}
+
+// Returns the slot of a unit id, or INVALID_INDEX if its unit was unregistered (even if the slot was reused since)
+int TimeUnitManager::resolve_unit_id(int unit_id) const {
+	if (unit_id < 0) {
+		return INVALID_INDEX;
 	}
-	return 1;
+	int index = unit_id & UNIT_ID_SLOT_MASK;
+	if (!is_valid_index(index) || get_unit_id_at(index) != unit_id) {
+		return INVALID_INDEX;
+	}
+	return index;
 }
 
-// Returns the trigger count for a simple time unit
-int TimeUnitManager::get_trigger_count(const String &name) const {
-	if (units.has(name)) {
-		Dictionary unit = units[name];
-		return unit.has("trigger_count") ? (int)unit["trigger_count"] : 1;
+// Private methods
+// Returns the slot for a unit name, reusing a free slot or growing the table
+// Returns INVALID_INDEX (with an error) once every slot an id can address is taken
+int TimeUnitManager::allocate_slot(const StringName &name) {
+	const int *existing = name_to_index.getptr(name);
+	if (existing) {
+		return *existing;
+	}
+
+	int index;
+	if (!free_slots.is_empty()) {
+		index = free_slots[free_slots.size() - 1];
+		free_slots.remove_at(free_slots.size() - 1);
+	} else {
+		index = names.size();
+		if (index > UNIT_ID_SLOT_MASK) {
+			UtilityFunctions::push_error(vformat("TimeTick: Cannot register '%s', the table is limited to %d units", name, UNIT_ID_SLOT_MASK + 1));
+			return INVALID_INDEX;
+		}
+		uint32_t new_size = index + 1;
+		names.resize(new_size);
+		tracked_names.resize(new_size);
+		parents.resize(new_size);
+		children.resize(new_size);
+		complex_dependents.resize(new_size);
+		state.resize(new_size);
+		steps.resize(new_size);
+		trigger_counts.resize(new_size);
+		min_values.resize(new_size);
+		max_values.resize(new_size);
+		complex_flags.resize(new_size);
+		tracked_units.resize(new_size);
+		condition_begins.resize(new_size);
+		condition_counts.resize(new_size);
+		if (generations.size() < new_size) {
+			generations.push_back(0);
+		}
 	}
-	return 1;
+
+	names[index] = name;
+	state.counters[index] = 0;
+	name_to_index.insert(name, index);
+	order.push_back(index);
+	return index;
 }
 
-// Returns the minimum value for a time unit
-int TimeUnitManager::get_min_value(const String &name) const {
-	if (units.has(name)) {
-		Dictionary unit = units[name];
-		return unit.has("min_value") ? (int)unit["min_value"] : 0;
+// Resolves a tracked unit name to an index ("tick" is the implicit root)
+int TimeUnitManager::resolve_index(const StringName &name) const {
+	if (name == tick_name) {
+		return TICK_INDEX;
 	}
-	return 0;
+	return find_index(name);
 }
 
-// Returns the maximum value for a time unit (-1 means no max)
-int TimeUnitManager::get_max_value(const String &name) const {
-	if (units.has(name)) {
-		Dictionary unit = units[name];
-		return unit.has("max_value") ? (int)unit["max_value"] : -1;
+// Returns how many units a unit depends on (its tracked unit, or every tracked unit of a complex unit)
+int TimeUnitManager::get_dependency_count(int index) const {
+	return complex_flags[index] ? condition_counts[index] : 1;
+}
+
+// Returns the index of a unit dependency (may be TICK_INDEX or INVALID_INDEX)
+int TimeUnitManager::get_dependency(int index, int dependency) const {
+	return complex_flags[index] ? condition_units[condition_begins[index] + dependency] : parents[index];
+}
+
+// Returns true if the unit called name is reachable by following tracked units upwards from a slot
+// Tracked names are compared as strings so units that aren't registered yet are still considered
+bool TimeUnitManager::reaches(const StringName &name, int from) const {
+	if (from < 0) {
+		return false;
+	}
+
+	LocalVector<int> stack;
+	LocalVector<uint8_t> visited;
+	visited.resize(names.size());
+	for (uint32_t i = 0; i < visited.size(); i++) {
+		visited[i] = 0;
+	}
+	stack.push_back(from);
+
+	while (!stack.is_empty()) {
+		int index = stack[stack.size() - 1];
+		stack.remove_at(stack.size() - 1);
+		if (visited[index]) {
+			continue;
+		}
+		visited[index] = 1;
+
+		if (names[index] == name) {
+			return true;
+		}
+
+		if (complex_flags[index]) {
+			Array keys = tracked_units[index].keys();
+			for (int i = 0; i < keys.size(); i++) {
+				StringName tracked_name = keys[i];
+				if (tracked_name == name) {
+					return true;
+				}
+				int dependency = resolve_index(tracked_name);
+				if (dependency >= 0) {
+					stack.push_back(dependency);
+				}
+			}
+		} else {
+			if (tracked_names[index] == name) {
+				return true;
+			}
+			if (parents[index] >= 0) {
+				stack.push_back(parents[index]);
+			}
+		}
 	}
-	return -1;
+
+	return false;
 }
 
-// Returns the name of the unit being tracked by a simple unit
-String TimeUnitManager::get_tracked_unit(const String &name) const {
-	if (units.has(name)) {
-		Dictionary unit = units[name];
-		return unit.has("tracked_unit") ? (String)unit["tracked_unit"] : "";
+// Re-resolves tracked names to indices and rebuilds the complex dependent lists after the set of units changed
+// Units may track names that are registered later, so links are rebuilt on every registration change
+void TimeUnitManager::relink() {
+	condition_units.clear();
+	condition_values.clear();
+	tick_complex_dependents.clear();
+	for (uint32_t i = 0; i < complex_dependents.size(); i++) {
+		complex_dependents[i].clear();
 	}
-	return "";
+
+	for (uint32_t i = 0; i < order.size(); i++) {
+		int index = order[i];
+
+		if (!complex_flags[index]) {
+			int parent = resolve_index(tracked_names[index]);
+			parents[index] = parent;
+			condition_begins[index] = 0;
+			condition_counts[index] = 0;
+			continue;
+		}
+
+		parents[index] = INVALID_INDEX;
+		const Dictionary &conditions = tracked_units[index];
+		Array keys = conditions.keys();
+		condition_begins[index] = condition_units.size();
+		condition_counts[index] = keys.size();
+		for (int j = 0; j < keys.size(); j++) {
+			StringName tracked_name = keys[j];
+			int tracked = resolve_index(tracked_name);
+			condition_units.push_back(tracked);
+			condition_values.push_back((int)conditions[keys[j]]);
+
+			if (tracked == TICK_INDEX) {
+				tick_complex_dependents.push_back(index);
+			} else if (tracked >= 0) {
+				complex_dependents[tracked].push_back(index);
+			}
+		}
+	}
+
+	compile();
 }
 
-// Returns the dictionary of tracked units for a complex unit
-Dictionary TimeUnitManager::get_tracked_units(const String &name) const {
-	if (units.has(name)) {
-		Dictionary unit = units[name];
-		return unit.has("tracked_units") ? (Dictionary)unit["tracked_units"] : Dictionary();
+// Compiles the unit graph into a flat evaluation plan where every unit comes after the units it tracks
+// Uses an iterative depth-first search, so deep hierarchies don't grow the call stack,
+// then orders the plan level by level (units tracking "tick" first, their dependents next, ...)
+// and indexes the simple units tracking each unit in that order
+void TimeUnitManager::compile() {
+	plan.clear();
+
+	// 0 = not visited, 1 = on the current path, 2 = already in the plan
+	LocalVector<uint8_t> marks;
+	marks.resize(names.size());
+	for (uint32_t i = 0; i < marks.size(); i++) {
+		marks[i] = 0;
+	}
+
+	LocalVector<int> stack_units;
+	LocalVector<int> stack_edges;
+
+	for (uint32_t i = 0; i < order.size(); i++) {
+		int root = order[i];
+		if (marks[root] != 0) {
+			continue;
+		}
+
+		marks[root] = 1;
+		stack_units.push_back(root);
+		stack_edges.push_back(0);
+
+		while (!stack_units.is_empty()) {
+			uint32_t top = stack_units.size() - 1;
+			int index = stack_units[top];
+			int edge = stack_edges[top];
+
+			if (edge < get_dependency_count(index)) {
+				stack_edges[top] = edge + 1;
+				int dependency = get_dependency(index, edge);
+				if (dependency < 0) {
+					continue;
+				}
+
+				if (marks[dependency] == 1) {
+					// Registration rejects cycles, this only guards against a corrupted graph
+					UtilityFunctions::push_error(vformat("TimeTick: Dependency cycle between '%s' and '%s', ignoring the link", names[index], names[dependency]));
+				} else if (marks[dependency] == 0) {
+					marks[dependency] = 1;
+					stack_units.push_back(dependency);
+					stack_edges.push_back(0);
+				}
+				continue;
+			}
+
+			marks[index] = 2;
+			plan.push_back(index);
+			stack_units.remove_at(top);
+			stack_edges.remove_at(top);
+		}
+	}
+
+	// Group the plan by level: a unit's level is one more than the deepest unit it tracks,
+	// so every unit of a level only reads fire counts from earlier levels
+	levels.resize(names.size());
+	for (uint32_t i = 0; i < levels.size(); i++) {
+		levels[i] = 0;
+	}
+	int level_count = 0;
+	for (uint32_t i = 0; i < plan.size(); i++) {
+		int index = plan[i];
+		int level = 0;
+		for (int d = 0; d < get_dependency_count(index); d++) {
+			int dependency = get_dependency(index, d);
+			if (dependency >= 0 && levels[dependency] + 1 > level) {
+				level = levels[dependency] + 1;
+			}
+		}
+		levels[index] = level;
+		level_count = MAX(level_count, level + 1);
+	}
+
+	// Stable counting sort, units of the same level keep their dependency order
+	level_begins.resize(level_count + 1);
+	for (uint32_t i = 0; i < level_begins.size(); i++) {
+		level_begins[i] = 0;
+	}
+	for (uint32_t i = 0; i < plan.size(); i++) {
+		level_begins[levels[plan[i]] + 1]++;
+	}
+	for (int level = 0; level < level_count; level++) {
+		level_begins[level + 1] += level_begins[level];
+	}
+
+	LocalVector<int> cursors = level_begins;
+	LocalVector<int> leveled;
+	leveled.resize(plan.size());
+	for (uint32_t i = 0; i < plan.size(); i++) {
+		int index = plan[i];
+		leveled[cursors[levels[index]]++] = index;
+	}
+	plan = leveled;
+
+	// Simple units tracking each unit, so a cascade only visits the children of units that fired
+	tick_children.clear();
+	for (uint32_t i = 0; i < children.size(); i++) {
+		children[i].clear();
+	}
+	for (uint32_t i = 0; i < plan.size(); i++) {
+		int index = plan[i];
+		if (complex_flags[index]) {
+			continue;
+		}
+		if (parents[index] == TICK_INDEX) {
+			tick_children.push_back(index);
+		} else if (parents[index] >= 0) {
+			children[parents[index]].push_back(index);
+		}
 	}
-	return Dictionary();
 }
 
-// Resets all time units to their minimum values
-void TimeUnitManager::reset_all_to_min() {
-	Array keys = units.keys();
-	for (int i = 0; i < keys.size(); i++) {
-		String name = keys[i];
-		int min_val = get_min_value(name);
-		set_value(name, min_val);
-		set_counter(name, 0);
+// Fills a state with the starting values of every unit, for a clock that shares this table as its definition
+void TimeUnitManager::init_state(TimeUnitState &r_state) const {
+	r_state.clear();
+	r_state.resize(names.size());
+	for (uint32_t i = 0; i < order.size(); i++) {
+		int index = order[i];
+		r_state.values[index] = min_values[index];
 	}
 }
 
-// Clears all registered units and counters
-void TimeUnitManager::clear() {
-	units.clear();
-	counters.clear();
+// Puts every unit of a state back to its minimum value and clears its counters
+void TimeUnitManager::reset_state(TimeUnitState &r_state) const {
+	for (uint32_t i = 0; i < order.size(); i++) {
+		int index = order[i];
+		r_state.values[index] = min_values[index];
+		r_state.counters[index] = 0;
+	}
+}
+
+// Recalculates every counter of a state from the values it tracks, after values were set directly
+// A counter is the tracked unit's progress since its minimum value, kept below the trigger count
+// so the next tick only moves the hierarchy by one step
+void TimeUnitManager::seed_counters(TimeUnitState &r_state, int current_tick) const {
+	for (uint32_t i = 0; i < order.size(); i++) {
+		int index = order[i];
+		if (complex_flags[index]) {
+			r_state.counters[index] = 0;
+			continue;
+		}
+
+		int tracked = parents[index];
+		int64_t progress = 0;
+		if (tracked == TICK_INDEX) {
+			progress = current_tick;
+		} else if (tracked >= 0) {
+			progress = (int64_t)r_state.values[tracked] - min_values[tracked];
+		}
+
+		int64_t trigger_count = trigger_counts[index];
+		int64_t counter = progress % trigger_count;
+		if (counter < 0) {
+			counter += trigger_count;
+		}
+		r_state.counters[index] = (int)counter;
+	}
 }
 
-// Initializes the counter for a unit to zero if it doesn't exist
-void TimeUnitManager::init_counter(const String &name) {
-	if (!counters.has(name)) {
-		counters[name] = 0;
+// Returns the ids of the complex units whose trigger latch is currently set, in ascending order
+PackedInt32Array TimeUnitState::get_triggered_units() const {
+	PackedInt32Array result;
+	for (uint32_t word = 0; word < triggered_bits.size(); word++) {
+		uint64_t bits = triggered_bits[word];
+		for (int bit = 0; bits != 0; bit++, bits >>= 1) {
+			if (bits & 1) {
+				result.push_back(int(word * 64 + bit));
+			}
+		}
+	}
+	return result;
+}
+
+// Grows the state to cover every slot, new slots start at 0 with their latch cleared
+void TimeUnitState::resize(uint32_t slot_count) {
+	uint32_t old_count = values.size();
+	if (slot_count <= old_count) {
+		return;
+	}
+	values.resize(slot_count);
+	counters.resize(slot_count);
+	for (uint32_t i = old_count; i < slot_count; i++) {
+		values[i] = 0;
+		counters[i] = 0;
+	}
+
+	uint32_t old_words = triggered_bits.size();
+	uint32_t word_count = (slot_count + 63) / 64;
+	if (word_count > old_words) {
+		triggered_bits.resize(word_count);
+		for (uint32_t i = old_words; i < word_count; i++) {
+			triggered_bits[i] = 0;
+		}
 	}
 }
 
-// Returns the current counter value for a unit
-int TimeUnitManager::get_counter(const String &name) const {
-	if (counters.has(name)) {
-		return counters[name];
+// Releases every value, counter, latch and listener
+void TimeUnitState::clear() {
+	values.clear();
+	counters.clear();
+	triggered_bits.clear();
+	listeners.clear();
+}
+
+// Connects a callable to a single unit
+// Entries are never shrunk so a listener can be added or removed while changes are being dispatched
+void TimeUnitState::add_listener(int index, const Callable &callable) {
+	if ((uint32_t)index >= listeners.size()) {
+		listeners.resize(index + 1);
+	}
+
+	LocalVector<Callable> &unit_listeners = listeners[index];
+	for (uint32_t i = 0; i < unit_listeners.size(); i++) {
+		if (unit_listeners[i].is_null()) {
+			unit_listeners[i] = callable;
+			return;
+		}
 	}
-	return 0;
+	unit_listeners.push_back(callable);
 }
 
-// Sets the counter value for a unit
-void TimeUnitManager::set_counter(const String &name, int value) {
-	counters[name] = value;
+// Disconnects a callable from a unit, returns false if it wasn't connected
+bool TimeUnitState::remove_listener(int index, const Callable &callable) {
+	if ((uint32_t)index >= listeners.size()) {
+		return false;
+	}
+
+	LocalVector<Callable> &unit_listeners = listeners[index];
+	for (uint32_t i = 0; i < unit_listeners.size(); i++) {
+		if (unit_listeners[i] == callable) {
+			unit_listeners[i] = Callable();
+			return true;
+		}
+	}
+	return false;
 }
 
-// Increments the counter for a unit by the specified amount
-void TimeUnitManager::increment_counter(const String &name, int amount) {
-	int current = get_counter(name);
-	counters[name] = current + amount;
+// Returns true if the callable is connected to the unit
+bool TimeUnitState::has_listener(int index, const Callable &callable) const {
+	if ((uint32_t)index >= listeners.size()) {
+		return false;
+	}
+
+	const LocalVector<Callable> &unit_listeners = listeners[index];
+	for (uint32_t i = 0; i < unit_listeners.size(); i++) {
+		if (unit_listeners[i] == callable) {
+			return true;
+		}
+	}
+	return false;
 }
 
-// Decrements the counter for a unit by the specified amount
-void TimeUnitManager::decrement_counter(const String &name, int amount) {
-	int current = get_counter(name);
-	counters[name] = current - amount;
+// Drops every listener of a unit, used when its slot is released
+void TimeUnitState::clear_listeners(int index) {
+	if ((uint32_t)index < listeners.size()) {
+		listeners[index].clear();
+	}
 }
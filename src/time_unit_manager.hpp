@@ -3,62 +3,189 @@
 
 #pragma once
 
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/callable.hpp>
 #include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
 #include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/string_name.hpp>
 #include <godot_cpp/variant/typed_array.hpp>
 
 using namespace godot;
 
 
+// Mutable per-clock part of a unit table: everything a tick writes, plus the clock's listeners
+// The manager owns one for its own clock, clocks sharing a definition bring their own
+struct TimeUnitState {
+	LocalVector<int> values;
+	LocalVector<int> counters;
+	// Complex unit trigger latches, one bit per slot
+	LocalVector<uint64_t> triggered_bits;
+	// Callables connected to a single unit, only grown up to the highest unit that has one
+	LocalVector<LocalVector<Callable>> listeners;
+
+	bool is_triggered(int index) const { return (triggered_bits[index >> 6] >> (index & 63)) & 1; }
+	void set_triggered(int index, bool state) {
+		uint64_t mask = uint64_t(1) << (index & 63);
+		triggered_bits[index >> 6] = state ? (triggered_bits[index >> 6] | mask) : (triggered_bits[index >> 6] & ~mask);
+	}
+	PackedInt32Array get_triggered_units() const;
+	void resize(uint32_t slot_count);
+	void clear();
+
+	// Per-unit listeners
+	void add_listener(int index, const Callable &callable);
+	bool remove_listener(int index, const Callable &callable);
+	bool has_listener(int index, const Callable &callable) const;
+	void clear_listeners(int index);
+	const LocalVector<Callable> *get_listeners_at(int index) const { return (uint32_t)index < listeners.size() ? &listeners[index] : nullptr; }
+};
+
+
 // Internal helper class to manage time unit storage and operations
 // This is NOT exposed to Godot. This is just for internal organization.
+//
+// Units live in a dense struct-of-arrays table addressed by index. Names are
+// interned StringNames, only looked up once to resolve an index; the tick
+// cascade works on indices.
 class TimeUnitManager {
 public:
+	// Index used for the implicit "tick" unit
+	static constexpr int TICK_INDEX = -1;
+	// Index used for names that are not registered (yet)
+	static constexpr int INVALID_INDEX = -2;
+	// A unit id is its slot in the low bits and the slot's generation above them,
+	// so an id cached before its slot was reused by another unit is rejected
+	static constexpr int UNIT_ID_SLOT_BITS = 20;
+	static constexpr int UNIT_ID_SLOT_MASK = (1 << UNIT_ID_SLOT_BITS) - 1;
+	static constexpr int UNIT_ID_GENERATION_MASK = (1 << (31 - UNIT_ID_SLOT_BITS)) - 1;
+
 	TimeUnitManager() = default;
 	~TimeUnitManager() = default;
 
 	// Registration
-	void register_simple_unit(const String &name, const String &tracked_unit, int trigger_count, int max_value, int min_value);
-	void register_complex_unit(const String &name, const Dictionary &tracked_units, int max_value, int min_value);
-	void unregister_unit(const String &name);
-	
+	void register_simple_unit(const StringName &name, const StringName &tracked_unit, int trigger_count, int max_value, int min_value);
+	void register_complex_unit(const StringName &name, const Dictionary &tracked_units, int max_value, int min_value);
+	void unregister_unit(const StringName &name);
+
 	// Getters
-	bool has_unit(const String &name) const;
-	Dictionary get_unit(const String &name) const;
-	int get_value(const String &name) const;
+	bool has_unit(const StringName &name) const;
+	Dictionary get_unit(const StringName &name) const;
 	TypedArray<String> get_all_names() const;
-	
+
 	// Setters
-	void set_value(const String &name, int value);
-	void set_step(const String &name, int step);
-	void set_trigger_count(const String &name, int count);
-	void set_min_value(const String &name, int min_val);
-	
+	void set_step(const StringName &name, int step);
+	void set_trigger_count(const StringName &name, int count);
+	void set_min_value(const StringName &name, int min_val);
+
 	// Queries
-	bool is_complex(const String &name) const;
-	int get_step(const String &name) const;
-	int get_trigger_count(const String &name) const;
-	int get_min_value(const String &name) const;
-	int get_max_value(const String &name) const;
-	String get_tracked_unit(const String &name) const;
-	Dictionary get_tracked_units(const String &name) const;
-	
+	bool is_complex(const StringName &name) const;
+	int get_step(const StringName &name) const;
+	int get_trigger_count(const StringName &name) const;
+	int get_min_value(const StringName &name) const;
+	int get_max_value(const StringName &name) const;
+	Dictionary get_tracked_units(const StringName &name) const;
+
+	// Dependency graph
+	bool would_create_cycle(const StringName &name, const StringName &tracked_unit) const;
+	bool would_create_cycle(const StringName &name, const Dictionary &tracked_units) const;
+
 	// Bulk operations
-	void reset_all_to_min();
 	void clear();
-	
-	// Counter management
-	void init_counter(const String &name);
-	int get_counter(const String &name) const;
-	void set_counter(const String &name, int value);
-	void increment_counter(const String &name, int amount);
-	void decrement_counter(const String &name, int amount);
-	
-	Array get_all_unit_names() const { return units.keys(); }
-	
+
+	// Index based access (used by the processor on the hot path)
+	int find_index(const StringName &name) const;
+	int get_unit_id_at(int index) const { return index | (int(generations[index]) << UNIT_ID_SLOT_BITS); }
+	int find_unit_id(const StringName &name) const;
+	int resolve_unit_id(int unit_id) const;
+	bool is_valid_index(int index) const { return index >= 0 && index < (int)names.size() && names[index] != StringName(); }
+	const LocalVector<int> &get_unit_order() const { return order; }
+	const LocalVector<int> &get_plan() const { return plan; }
+	int get_level_count() const { return level_begins.is_empty() ? 0 : level_begins.size() - 1; }
+	int get_level_begin(int level) const { return level_begins[level]; }
+	int get_slot_count() const { return names.size(); }
+	const StringName &get_name_at(int index) const { return names[index]; }
+	bool is_complex_at(int index) const { return complex_flags[index] != 0; }
+	int get_parent_at(int index) const { return parents[index]; }
+	const LocalVector<int> &get_children_at(int index) const { return index == TICK_INDEX ? tick_children : children[index]; }
+	int get_level_at(int index) const { return levels[index]; }
+	const LocalVector<int> &get_complex_dependents_at(int index) const { return index == TICK_INDEX ? tick_complex_dependents : complex_dependents[index]; }
+	int get_step_at(int index) const { return index == TICK_INDEX ? 1 : steps[index]; }
+	void set_step_at(int index, int step) { steps[index] = step; }
+	int get_trigger_count_at(int index) const { return trigger_counts[index]; }
+	int get_min_value_at(int index) const { return min_values[index]; }
+	int get_max_value_at(int index) const { return max_values[index]; }
+
+	// Per-clock state: the manager's own, and fresh copies for clocks sharing this table as a definition
+	TimeUnitState &get_state() { return state; }
+	const TimeUnitState &get_state() const { return state; }
+	void init_state(TimeUnitState &r_state) const;
+	void reset_state(TimeUnitState &r_state) const;
+	void seed_counters(TimeUnitState &r_state, int current_tick) const;
+
+	// Complex unit conditions, stored as packed unit index / threshold vectors
+	// A complex unit owns the contiguous range [begin, begin + count)
+	int get_condition_begin(int index) const { return condition_begins[index]; }
+	int get_condition_count(int index) const { return condition_counts[index]; }
+	int get_condition_unit(int condition) const { return condition_units[condition]; }
+	int get_condition_value(int condition) const { return condition_values[condition]; }
+	const int *get_condition_units_ptr() const { return condition_units.ptr(); }
+	const int *get_condition_values_ptr() const { return condition_values.ptr(); }
+
 private:
-	// Stores time unit data
-	Dictionary units;
-	// Stores accumulation counters for
-	Dictionary counters;
+	// Name of the implicit root unit
+	StringName tick_name = "tick";
+
+	// Name to slot lookup
+	HashMap<StringName, int> name_to_index;
+	// Live slots in registration order
+	LocalVector<int> order;
+	// Slots released by unregister_unit, reused by the next registration
+	LocalVector<int> free_slots;
+	// Generation of each slot, bumped when its unit is unregistered or the table is cleared
+	// Kept across clear(), so ids from before it are rejected too
+	LocalVector<uint16_t> generations;
+
+	// Unit table (struct-of-arrays, one entry per slot)
+	LocalVector<StringName> names;
+	LocalVector<StringName> tracked_names;
+	LocalVector<int> parents;
+	LocalVector<int> steps;
+	LocalVector<int> trigger_counts;
+	LocalVector<int> min_values;
+	LocalVector<int> max_values;
+	LocalVector<uint8_t> complex_flags;
+
+	// Values, counters, trigger latches and listeners of the manager's own clock
+	TimeUnitState state;
+
+	// Reverse dependency index: simple units tracking each slot (and "tick"), in plan order
+	LocalVector<LocalVector<int>> children;
+	LocalVector<int> tick_children;
+	// Complex units tracking each slot (and "tick"), in registration order
+	LocalVector<LocalVector<int>> complex_dependents;
+	LocalVector<int> tick_complex_dependents;
+
+	// Complex unit definitions (source dictionary plus resolved conditions)
+	LocalVector<Dictionary> tracked_units;
+	LocalVector<int> condition_begins;
+	LocalVector<int> condition_counts;
+	LocalVector<int> condition_units;
+	LocalVector<int> condition_values;
+
+	// Compiled cascade plan: live units in dependency order (tracked units before their dependents)
+	LocalVector<int> plan;
+	// Plan offsets of each hierarchy level, level i is [level_begins[i], level_begins[i + 1])
+	LocalVector<int> level_begins;
+	// Hierarchy level of each slot
+	LocalVector<int> levels;
+
+	int allocate_slot(const StringName &name);
+	int resolve_index(const StringName &name) const;
+	int get_dependency_count(int index) const;
+	int get_dependency(int index, int dependency) const;
+	bool reaches(const StringName &name, int from) const;
+	void relink();
+	void compile();
 };
@@ -4,228 +4,522 @@
 #include "time_unit_processor.hpp"
 #include <godot_cpp/variant/utility_functions.hpp>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TIME_TICK_SSE2
+#endif
+
 using namespace godot;
 
 
-// Increments a unit and cascades to all dependent child units
-void TimeUnitProcessor::increment_unit(const String &unit_name) {
-	Array all_units = unit_manager->get_all_unit_names();
-	
-	for (int i = 0; i < all_units.size(); i++) {
-		String child_name = all_units[i];
-		
-		if (unit_manager->is_complex(child_name)) {
-			process_complex_unit(child_name, unit_name);
-		} else {
-			String tracked = unit_manager->get_tracked_unit(child_name);
-			if (tracked == unit_name) {
-				process_simple_unit_increment(child_name, unit_name);
-			}
-		}
+// Returns true when every value is at least its threshold
+// Compares four lanes at a time with SSE2, the scalar loop handles the tail (and every other platform)
+static bool all_at_least(const int *values, const int *thresholds, int count) {
+	int i = 0;
+#ifdef TIME_TICK_SSE2
+	__m128i below = _mm_setzero_si128();
+	for (; i + 4 <= count; i += 4) {
+		__m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + i));
+		__m128i required = _mm_loadu_si128(reinterpret_cast<const __m128i *>(thresholds + i));
+		below = _mm_or_si128(below, _mm_cmplt_epi32(current, required));
+	}
+	if (_mm_movemask_epi8(below) != 0) {
+		return false;
+	}
+#endif
+	int below_count = 0;
+	for (; i < count; i++) {
+		below_count += values[i] < thresholds[i] ? 1 : 0;
 	}
+	return below_count == 0;
 }
 
-// Decrements a unit and cascades to all dependent child units (reverse time)
-void TimeUnitProcessor::decrement_unit(const String &unit_name) {
-	Array all_units = unit_manager->get_all_unit_names();
-	
-	for (int i = 0; i < all_units.size(); i++) {
-		String child_name = all_units[i];
-		
-		// Complex units don't support reverse time yet
-		if (unit_manager->is_complex(child_name)) {
-			continue;
-		}
-		
-		String tracked = unit_manager->get_tracked_unit(child_name);
-		if (tracked == unit_name) {
-			process_simple_unit_decrement(child_name, unit_name);
+// Largest carry or step total the bulk paths compute exactly, anything beyond saturates
+// Half of int64_t, so adding an int value or counter to it can't overflow
+static const int64_t BULK_LIMIT = INT64_MAX / 2;
+
+// Returns a * b, saturated to +/-BULK_LIMIT (a huge advance_ticks() times a large step)
+// r_saturated is set to true when the product didn't fit
+static int64_t multiply_saturated(int64_t a, int64_t b, bool *r_saturated = nullptr) {
+	if (r_saturated) {
+		*r_saturated = false;
+	}
+	if (a == 0 || b == 0) {
+		return 0;
+	}
+	uint64_t abs_a = a < 0 ? 0 - (uint64_t)a : (uint64_t)a;
+	uint64_t abs_b = b < 0 ? 0 - (uint64_t)b : (uint64_t)b;
+	if (abs_a > (uint64_t)BULK_LIMIT / abs_b) {
+		if (r_saturated) {
+			*r_saturated = true;
 		}
+		return (a < 0) != (b < 0) ? -BULK_LIMIT : BULK_LIMIT;
 	}
+	return a * b;
 }
 
-// Processes increment for a simple unit, handling counters, overflow, and wrapping
-void TimeUnitProcessor::process_simple_unit_increment(const String &child_name, const String &parent_name) {
-	int counter = unit_manager->get_counter(child_name);
-	int parent_step = unit_manager->get_step(parent_name);
-	counter += parent_step;
-	
-	int trigger_count = unit_manager->get_trigger_count(child_name);
+// Returns value modulo range, in [0, range)
+static uint64_t floor_mod(int64_t value, int64_t range) {
+	int64_t result = value % range;
+	return (uint64_t)(result < 0 ? result + range : result);
+}
+
+
+// Runs one forward tick through the compiled plan
+void TimeUnitProcessor::process_tick_forward() {
+	advance_forward(1);
+}
+
+// Runs one backward tick through the compiled plan (reverse time)
+void TimeUnitProcessor::process_tick_backward() {
+	advance_backward(1);
+}
+
+// Advances every unit by a number of ticks at once
+// Each unit computes its carries with integer division instead of looping tick by tick,
+// complex units are checked once against the final values
+// Only units whose tracked unit fired are visited, level by level, so a tick that only moves
+// "second" touches only "second"; a level only reads fire counts written by earlier levels
+void TimeUnitProcessor::advance_forward(int64_t ticks) {
+	if (ticks <= 0) {
+		return;
+	}
+	uint32_t first_change = begin_cascade();
+	tick_fires = ticks;
+	queue_children(TimeUnitManager::TICK_INDEX);
+	mark_complex_dependents(TimeUnitManager::TICK_INDEX);
 	
-	if (counter >= trigger_count) {
-		counter -= trigger_count;
-		unit_manager->set_counter(child_name, counter);
-		
-		int old_value = unit_manager->get_value(child_name);
-		int step = unit_manager->get_step(child_name);
-		int max_value = unit_manager->get_max_value(child_name);
-		int min_value = unit_manager->get_min_value(child_name);
-		int new_value = old_value + step;
-		
-		// Check for overflow
-		if (step > 0 && old_value > INT_MAX - step) {
-			new_value = min_value;
-			UtilityFunctions::push_warning(vformat("TimeTick: Time unit '%s' would overflow, resetting to %d", child_name, min_value));
-		} else if (step < 0 && old_value < INT_MIN - step) {
-			new_value = min_value;
-			UtilityFunctions::push_warning(vformat("TimeTick: Time unit '%s' would underflow, resetting to %d", child_name, min_value));
-		}
-		
-		// Apply wrapping
-		bool did_wrap = false;
-		if (max_value > 0) {
-			int wrapped_value = apply_wrapping(new_value, min_value, max_value);
-			did_wrap = (wrapped_value != new_value);
-			new_value = wrapped_value;
+	int level_count = unit_manager->get_level_count();
+	for (int level = 0; level < level_count && frontier_size > 0; level++) {
+		int begin = unit_manager->get_level_begin(level);
+		int end = begin + frontier_counts[level];
+		for (int i = begin; i < end; i++) {
+			int unit_index = frontier[i];
+			int64_t fires = 0;
 			
-			// If wrapped, update value and trigger children before emitting signal
-			if (did_wrap) {
-				unit_manager->set_value(child_name, new_value);
-				increment_unit(child_name);
-				emit_change_signal(child_name, new_value, old_value);
-				return;
+			if (unit_manager->is_complex_at(unit_index)) {
+				fires = process_complex_unit(unit_index);
+			} else {
+				fires = advance_simple_unit(unit_index, get_fire_count(unit_manager->get_parent_at(unit_index)));
+			}
+			
+			fire_counts[unit_index] = fires;
+			if (fires > 0) {
+				queue_children(unit_index);
+				mark_complex_dependents(unit_index);
 			}
 		}
-		
-		// Normal flow: update value, emit signal, then trigger children
-		unit_manager->set_value(child_name, new_value);
-		
-		if (old_value != new_value) {
-			emit_change_signal(child_name, new_value, old_value);
+		frontier_size -= frontier_counts[level];
+		frontier_counts[level] = 0;
+	}
+	
+	tick_fires = 1;
+	if (!deferring_changes) {
+		flush_changes(first_change);
+	}
+}
+
+// Rewinds every unit by a number of ticks at once (reverse time)
+// Complex units don't support reverse time yet
+void TimeUnitProcessor::advance_backward(int64_t ticks) {
+	if (ticks <= 0) {
+		return;
+	}
+	uint32_t first_change = begin_cascade();
+	tick_fires = ticks;
+	queue_children(TimeUnitManager::TICK_INDEX);
+	
+	int level_count = unit_manager->get_level_count();
+	for (int level = 0; level < level_count && frontier_size > 0; level++) {
+		int begin = unit_manager->get_level_begin(level);
+		int end = begin + frontier_counts[level];
+		for (int i = begin; i < end; i++) {
+			int unit_index = frontier[i];
+			int64_t fires = rewind_simple_unit(unit_index, get_fire_count(unit_manager->get_parent_at(unit_index)));
+			fire_counts[unit_index] = fires;
+			if (fires > 0) {
+				queue_children(unit_index);
+			}
 		}
-		
-		increment_unit(child_name);
-	} else {
-		unit_manager->set_counter(child_name, counter);
+		frontier_size -= frontier_counts[level];
+		frontier_counts[level] = 0;
 	}
+	
+	tick_fires = 1;
+	if (!deferring_changes) {
+		flush_changes(first_change);
+	}
+}
+
+// Returns how many times a unit fired during the current tick (or bulk advance)
+int64_t TimeUnitProcessor::get_fire_count(int unit_index) const {
+	if (unit_index == TimeUnitManager::TICK_INDEX) {
+		return tick_fires;
+	}
+	return unit_index >= 0 ? fire_counts[unit_index] : 0;
 }
 
-// Processes decrement for a simple unit (reverse time support)
-void TimeUnitProcessor::process_simple_unit_decrement(const String &child_name, const String &parent_name) {
-	int counter = unit_manager->get_counter(child_name);
-	int parent_step = unit_manager->get_step(parent_name);
-	counter -= parent_step;
+// Applies the increments of its tracked unit to a simple unit
+// A unit whose counter passed its trigger count several times carries that many times at once
+// (e.g. a step 600 "minute" advances "hour" by 10), so one tick and a bulk advance give the same result
+// Returns how many times the unit incremented
+int64_t TimeUnitProcessor::advance_simple_unit(int child, int64_t parent_fires) {
+	int64_t counter = state->counters[child];
+	int64_t parent_step = unit_manager->get_step_at(unit_manager->get_parent_at(child));
+	int64_t trigger_count = unit_manager->get_trigger_count_at(child);
+	
+	counter += multiply_saturated(parent_fires, parent_step);
+	int64_t fires = 0;
+	if (counter >= trigger_count) {
+		fires = counter / trigger_count;
+		counter %= trigger_count;
+	}
+	// A negative parent step only ever lowers the counter, it saturates instead of truncating
+	state->counters[child] = (int)MAX(counter, (int64_t)INT_MIN);
+	
+	if (fires == 0) {
+		return 0;
+	}
+	
+	int old_value = state->values[child];
+	int max_value = unit_manager->get_max_value_at(child);
+	int min_value = unit_manager->get_min_value_at(child);
+	int64_t wraps = 0;
+	int64_t new_value = apply_steps(old_value, fires, unit_manager->get_step_at(child), min_value, max_value, &wraps);
+	
+	// Units with a max were wrapped by apply_steps(), the others reset on overflow
+	if (max_value <= 0 && new_value > INT_MAX) {
+		new_value = min_value;
+		UtilityFunctions::push_warning(vformat("TimeTick: Time unit '%s' would overflow, resetting to %d", unit_manager->get_name_at(child), min_value));
+	} else if (max_value <= 0 && new_value < INT_MIN) {
+		new_value = min_value;
+		UtilityFunctions::push_warning(vformat("TimeTick: Time unit '%s' would underflow, resetting to %d", unit_manager->get_name_at(child), min_value));
+	}
+	
+	state->values[child] = (int)new_value;
 	
-	int trigger_count = unit_manager->get_trigger_count(child_name);
+	if (wraps != 0 || new_value != old_value) {
+		record_change(child, (int)new_value, old_value);
+	}
+	
+	return fires;
+}
+
+// Applies the decrements of its tracked unit to a simple unit (reverse time support)
+// Borrows are computed at once, the same way advance_simple_unit computes carries
+// Returns how many times the unit decremented
+int64_t TimeUnitProcessor::rewind_simple_unit(int child, int64_t parent_fires) {
+	int64_t counter = state->counters[child];
+	int64_t parent_step = unit_manager->get_step_at(unit_manager->get_parent_at(child));
+	int64_t trigger_count = unit_manager->get_trigger_count_at(child);
 	
+	counter -= multiply_saturated(parent_fires, parent_step);
+	int64_t fires = 0;
 	if (counter < 0) {
-		counter += trigger_count;
-		unit_manager->set_counter(child_name, counter);
-		
-		int old_value = unit_manager->get_value(child_name);
-		int step = unit_manager->get_step(child_name);
-		int max_value = unit_manager->get_max_value(child_name);
-		int min_value = unit_manager->get_min_value(child_name);
-		int new_value = old_value - step;
-		
-		// Apply wrapping for reverse
-		if (max_value > 0) {
-			new_value = apply_wrapping(new_value, min_value, max_value);
-		} else if (new_value < 0) {
-			new_value = 0;
-		}
-		
-		unit_manager->set_value(child_name, new_value);
-		
-		if (old_value != new_value) {
-			emit_change_signal(child_name, new_value, old_value);
-		}
-		
-		decrement_unit(child_name);
-	} else {
-		unit_manager->set_counter(child_name, counter);
+		fires = (-counter - 1) / trigger_count + 1;
+		counter = (int64_t)floor_mod(counter, trigger_count);
 	}
+	// A negative parent step only ever raises the counter, it saturates instead of truncating
+	state->counters[child] = (int)MIN(counter, (int64_t)INT_MAX);
+	
+	if (fires == 0) {
+		return 0;
+	}
+	
+	int old_value = state->values[child];
+	int max_value = unit_manager->get_max_value_at(child);
+	int min_value = unit_manager->get_min_value_at(child);
+	int64_t new_value = apply_steps(old_value, fires, -(int64_t)unit_manager->get_step_at(child), min_value, max_value);
+	
+	// Units with a max were wrapped by apply_steps(), the others clamp
+	if (max_value <= 0) {
+		new_value = CLAMP(new_value, (int64_t)0, (int64_t)INT_MAX);
+	}
+	
+	state->values[child] = (int)new_value;
+	
+	if (new_value != old_value) {
+		record_change(child, (int)new_value, old_value);
+	}
+	
+	return fires;
 }
 
 // Processes complex units that depend on multiple tracked unit values
-void TimeUnitProcessor::process_complex_unit(const String &child_name, const String &parent_name) {
-	Dictionary tracked_units = unit_manager->get_tracked_units(child_name);
-	
-	// Only check if the parent being incremented is tracked
-	if (!tracked_units.has(parent_name)) {
-		return;
+// Returns 1 if the unit triggered during this tick
+int TimeUnitProcessor::process_complex_unit(int child) {
+	// Only check if one of the tracked units changed during this tick
+	if (!complex_pending[child]) {
+		return 0;
 	}
+	complex_pending[child] = 0;
 	
 	// Check if all conditions are met
-	bool all_met = check_complex_conditions(child_name);
-	
-	// Get or create trigger state
-	Dictionary unit = unit_manager->get_unit(child_name);
-	String state_key = String(child_name) + String("_triggered");
-	bool was_triggered = unit.has(state_key) && (bool)unit[state_key];
+	bool all_met = check_complex_conditions(child);
+	bool was_triggered = state->is_triggered(child);
 	
 	if (all_met && !was_triggered) {
 		// All conditions met, trigger!
-		int old_value = unit_manager->get_value(child_name);
-		int step = unit_manager->get_step(child_name);
-		int max_value = unit_manager->get_max_value(child_name);
-		int min_value = unit_manager->get_min_value(child_name);
-		int new_value = apply_wrapping(old_value + step, min_value, max_value);
+		int old_value = state->values[child];
+		int step = unit_manager->get_step_at(child);
+		int max_value = unit_manager->get_max_value_at(child);
+		int min_value = unit_manager->get_min_value_at(child);
+		int new_value = (int)apply_wrapping((int64_t)old_value + step, min_value, max_value);
 		
-		unit_manager->set_value(child_name, new_value);
+		state->values[child] = new_value;
 		
 		// Mark as triggered
-		unit[state_key] = true;
+		state->set_triggered(child, true);
 		
 		if (old_value != new_value) {
-			emit_change_signal(child_name, new_value, old_value);
+			record_change(child, new_value, old_value);
 		}
 		
-		increment_unit(child_name);
+		return 1;
 	} else if (!all_met && was_triggered) {
 		// Conditions no longer met, reset trigger
-		unit[state_key] = false;
+		state->set_triggered(child, false);
 	}
+	
+	return 0;
 }
 
 // Checks if all conditions for a complex unit are met
-bool TimeUnitProcessor::check_complex_conditions(const String &unit_name) {
-	Dictionary tracked_units = unit_manager->get_tracked_units(unit_name);
-	Array keys = tracked_units.keys();
-	
-	for (int i = 0; i < keys.size(); i++) {
-		String tracked_name = keys[i];
-		int required_value = tracked_units[tracked_name];
-		int current_value = 0;
-		
-		if (tracked_name == "tick") {
-			current_value = current_tick;
+// The tracked values are gathered into a contiguous buffer first, so the compare
+// is one branch-free pass over two packed vectors
+bool TimeUnitProcessor::check_complex_conditions(int unit_index) {
+	int begin = unit_manager->get_condition_begin(unit_index);
+	int count = unit_manager->get_condition_count(unit_index);
+	const int *units = unit_manager->get_condition_units_ptr() + begin;
+	const int *thresholds = unit_manager->get_condition_values_ptr() + begin;
+	
+	if (condition_operands.size() < (uint32_t)count) {
+		condition_operands.resize(count);
+		allocation_count++;
+	}
+	int *operands = condition_operands.ptr();
+	
+	for (int c = 0; c < count; c++) {
+		int tracked = units[c];
+		if (tracked == TimeUnitManager::TICK_INDEX) {
+			operands[c] = current_tick;
+		} else if (tracked >= 0) {
+			operands[c] = state->values[tracked];
 		} else {
-			current_value = unit_manager->get_value(tracked_name);
-		}
-		
-		if (current_value < required_value) {
-			return false;
+			operands[c] = 0;
 		}
 	}
 	
-	return true;
+	return all_at_least(operands, thresholds, count);
 }
 
-// Applies min/max wrapping to a value (e.g., 60 seconds wraps to 0)
-int TimeUnitProcessor::apply_wrapping(int value, int min_val, int max_val) {
+// Applies min/max wrapping to a value (e.g., 60 seconds wraps to 0) in constant time
+// r_wraps receives how many whole ranges were removed (negative when wrapping up from below min)
+// A unit without a max (max_val <= 0) doesn't wrap, an empty range collapses to min_val
+int64_t TimeUnitProcessor::apply_wrapping(int64_t value, int min_val, int max_val, int64_t *r_wraps) {
+	if (r_wraps) {
+		*r_wraps = 0;
+	}
 	if (max_val <= 0) {
 		return value;
 	}
 	
-	int range = max_val - min_val;
-	while (value >= max_val) {
-		value -= range;
+	int64_t range = (int64_t)max_val - min_val;
+	if (range <= 0) {
+		return min_val;
+	}
+	
+	int64_t offset = value - min_val;
+	int64_t wraps = offset / range;
+	offset %= range;
+	if (offset < 0) {
+		offset += range;
+		wraps--;
 	}
-	while (value < min_val) {
-		value += range;
+	if (r_wraps) {
+		*r_wraps = wraps;
+	}
+	return min_val + offset;
+}
+
+// Returns value + fires * step, wrapped like apply_wrapping()
+// A total too large for int64_t is reduced modulo the unit's range first, so wrapping units stay exact
+// after any number of ticks; a unit without a max gets a total saturated to +/-BULK_LIMIT
+// r_wraps is only guaranteed to be non-zero when the value wrapped, not the exact count, for such totals
+int64_t TimeUnitProcessor::apply_steps(int64_t value, int64_t fires, int64_t step, int min_val, int max_val, int64_t *r_wraps) {
+	bool saturated = false;
+	int64_t total = multiply_saturated(fires, step, &saturated);
+	if (!saturated || max_val <= 0) {
+		return apply_wrapping(value + total, min_val, max_val, r_wraps);
+	}
+	
+	int64_t range = (int64_t)max_val - min_val;
+	if (range <= 0) {
+		return apply_wrapping(value, min_val, max_val, r_wraps);
 	}
 	
-	return value;
+	// Both factors are below 2^32 once reduced, their product fits in uint64_t
+	uint64_t offset = (floor_mod(fires, range) * floor_mod(step, range)) % (uint64_t)range;
+	int64_t result = apply_wrapping(value + (int64_t)offset, min_val, max_val);
+	if (r_wraps) {
+		*r_wraps = total / range;
+	}
+	return result;
+}
+
+// Makes sure the scratch buffers cover every unit slot and returns where this cascade's changes start
+// Buffers only grow after registration changes, a steady-state tick doesn't allocate
+uint32_t TimeUnitProcessor::begin_cascade() {
+	uint32_t slot_count = unit_manager->get_slot_count();
+	if (fire_counts.size() != slot_count) {
+		fire_counts.resize(slot_count);
+		complex_pending.resize(slot_count);
+		for (uint32_t i = 0; i < slot_count; i++) {
+			complex_pending[i] = 0;
+		}
+		allocation_count++;
+	}
+	uint32_t plan_size = unit_manager->get_plan().size();
+	uint32_t level_count = unit_manager->get_level_count();
+	if (frontier.size() != plan_size || frontier_counts.size() != level_count) {
+		frontier.resize(plan_size);
+		frontier_counts.resize(level_count);
+		for (uint32_t i = 0; i < level_count; i++) {
+			frontier_counts[i] = 0;
+		}
+		allocation_count++;
+	}
+	frontier_size = 0;
+	return changes.size();
+}
+
+// Queues the simple units tracking a unit that just fired
+void TimeUnitProcessor::queue_children(int unit_index) {
+	const LocalVector<int> &children = unit_manager->get_children_at(unit_index);
+	for (uint32_t i = 0; i < children.size(); i++) {
+		queue_unit(children[i]);
+	}
 }
 
-// Emits the time_unit_changed signal through the callback
-void TimeUnitProcessor::emit_change_signal(const String &name, int new_val, int old_val) {
-	if (signal_callback.is_valid()) {
-		Array args;
-		args.append(name);
-		args.append(new_val);
-		args.append(old_val);
-		signal_callback.callv(args);
+// Adds a unit to its level's bucket of the frontier
+void TimeUnitProcessor::queue_unit(int unit_index) {
+	int level = unit_manager->get_level_at(unit_index);
+	frontier[unit_manager->get_level_begin(level) + frontier_counts[level]++] = unit_index;
+	frontier_size++;
+}
+
+// Flags and queues the complex units tracking a unit that just fired, so only those get their conditions checked
+void TimeUnitProcessor::mark_complex_dependents(int unit_index) {
+	const LocalVector<int> &dependents = unit_manager->get_complex_dependents_at(unit_index);
+	for (uint32_t i = 0; i < dependents.size(); i++) {
+		int dependent = dependents[i];
+		if (!complex_pending[dependent]) {
+			complex_pending[dependent] = 1;
+			queue_unit(dependent);
+		}
+	}
+}
+
+// Buffers a value change until the cascade has finished
+void TimeUnitProcessor::record_change(int unit_index, int new_val, int old_val) {
+	if (!reporting_changes) {
+		return;
+	}
+	if (changes.size() == change_capacity) {
+		change_capacity = MAX(change_capacity * 2, (uint32_t)MAX(unit_manager->get_slot_count(), 8));
+		changes.reserve(change_capacity);
+		allocation_count++;
+	}
+	
+	UnitChange change;
+	change.unit = unit_index;
+	change.new_value = new_val;
+	change.old_value = old_val;
+	changes.push_back(change);
+}
+
+// Emits the buffered changes of a cascade, in plan order, once every unit has its final value for the tick
+// A listener may start another cascade (e.g. advance_ticks) from a signal, it appends and flushes its own range
+void TimeUnitProcessor::flush_changes(uint32_t first) {
+	if (batch_changes) {
+		emit_batch_signal(first);
+		for (uint32_t i = first; i < changes.size(); i++) {
+			UnitChange change = changes[i];
+			call_listeners(change.unit, change.new_value, change.old_value);
+		}
+	} else {
+		for (uint32_t i = first; i < changes.size(); i++) {
+			UnitChange change = changes[i];
+			emit_change_signal(change.unit, change.new_value, change.old_value);
+		}
+	}
+	changes.resize(first);
+}
+
+// Emits every change of a cascade at once as packed (unit id, new value, old value) arrays
+void TimeUnitProcessor::emit_batch_signal(uint32_t first) {
+	int count = changes.size() - first;
+	if (count == 0 || !signal_target) {
+		return;
+	}
+	
+	if ((uint32_t)count >= batch_payloads.size()) {
+		batch_payloads.resize(count + 1);
+		allocation_count++;
+	}
+	BatchPayload &payload = batch_payloads[count];
+	if (payload.units.size() != count) {
+		payload.units.resize(count);
+		payload.new_values.resize(count);
+		payload.old_values.resize(count);
+		allocation_count++;
+	}
+	
+	int32_t *units = write_batch_array(payload.units);
+	int32_t *new_values = write_batch_array(payload.new_values);
+	int32_t *old_values = write_batch_array(payload.old_values);
+	for (int i = 0; i < count; i++) {
+		const UnitChange &change = changes[first + i];
+		units[i] = unit_manager->get_unit_id_at(change.unit);
+		new_values[i] = change.new_value;
+		old_values[i] = change.old_value;
+	}
+	
+	signal_target->emit_signal(batch_signal_name, current_tick, payload.units, payload.new_values, payload.old_values);
+}
+
+// Returns a batch array for writing
+// A listener that kept the array from an earlier tick shares its buffer, writing then copies it
+int32_t *TimeUnitProcessor::write_batch_array(PackedInt32Array &array) {
+	const int32_t *shared = array.ptr();
+	int32_t *data = array.ptrw();
+	if (data != shared) {
+		allocation_count++;
+	}
+	return data;
+}
+
+// Emits the change signal directly on the target with the unit's pre-built StringName,
+// then calls only the listeners connected to this unit
+void TimeUnitProcessor::emit_change_signal(int unit_index, int new_val, int old_val) {
+	if (signal_target) {
+		signal_target->emit_signal(signal_name, unit_manager->get_name_at(unit_index), new_val, old_val);
+	}
+	call_listeners(unit_index, new_val, old_val);
+}
+
+// Calls the listeners connected to a single unit
+void TimeUnitProcessor::call_listeners(int unit_index, int new_val, int old_val) {
+	// Listeners may connect or disconnect while being called, which can grow the listener
+	// table, so the unit's list is looked up again every step
+	for (uint32_t i = 0;; i++) {
+		const LocalVector<Callable> *listeners = state->get_listeners_at(unit_index);
+		if (!listeners || i >= listeners->size()) {
+			break;
+		}
+		Callable listener = (*listeners)[i];
+		if (listener.is_valid()) {
+			listener.call(new_val, old_val);
+		}
 	}
 }
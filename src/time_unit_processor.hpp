@@ -4,36 +4,138 @@
 #pragma once
 
 #include "time_unit_manager.hpp"
-#include <godot_cpp/variant/callable.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/core/object.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/string_name.hpp>
 
 using namespace godot;
 
 // Internal helper class to handle time unit increment/decrement logic
 // This is NOT exposed to Godot. This is just for internal organization.
+//
+// A tick runs the manager's compiled plan front to back: every unit reads how
+// many times its tracked unit fired during this tick, updates itself and
+// records its own fire count for its dependents. Changes are buffered and the
+// signals are emitted once the whole cascade has been applied.
 class TimeUnitProcessor {
 public:
-	TimeUnitProcessor(TimeUnitManager *manager) : unit_manager(manager) {}
+	TimeUnitProcessor(TimeUnitManager *manager) : unit_manager(manager), state(&manager->get_state()) {}
 	~TimeUnitProcessor() = default;
 	
-	// Set signal emission callback
-	void set_signal_callback(Callable callback) { signal_callback = callback; }
+	// Values the cascade reads and writes, the manager's own state unless a shared-definition clock swaps its own in
+	void set_state(TimeUnitState *p_state) { state = p_state; }
+	TimeUnitState *get_state() const { return state; }
+	
+	// Switches to another unit table, e.g. a definition shared through a TimeCalendar, with the clock's own state
+	void set_unit_manager(TimeUnitManager *manager, TimeUnitState *p_state) {
+		unit_manager = manager;
+		state = p_state;
+	}
+	
+	// When disabled, changes are applied without being buffered or reported
+	void set_reporting_changes(bool enabled) { reporting_changes = enabled; }
+	
+	// Set the object and signals used to report unit changes
+	void set_signal_target(Object *target, const StringName &change_signal, const StringName &batch_signal) {
+		signal_target = target;
+		signal_name = change_signal;
+		batch_signal_name = batch_signal;
+	}
 	void set_current_tick(int tick) { current_tick = tick; }
 	
+	// Keeps the changes of the following cascades buffered until flush_deferred_changes()
+	// Lets cascades run off the main thread, their signals are emitted by the flush
+	void defer_changes() {
+		deferring_changes = true;
+		deferred_first = changes.size();
+	}
+	void flush_deferred_changes() {
+		deferring_changes = false;
+		flush_changes(deferred_first);
+	}
+	
+	// When enabled, a cascade reports all its changes with one batch signal instead of one signal per unit
+	void set_batch_changes(bool enabled) { batch_changes = enabled; }
+	bool is_batching_changes() const { return batch_changes; }
+	
+	// Reports a unit change: time_unit_changed plus the unit's own listeners
+	void emit_change_signal(int unit_index, int new_val, int old_val);
+	
+	// Number of times the tick path had to allocate (scratch buffers growing, batch arrays
+	// created or copied because a listener kept them)
+	uint64_t get_allocation_count() const { return allocation_count; }
+	
 	// Core processing
-	void increment_unit(const String &unit_name);
-	void decrement_unit(const String &unit_name);
+	void process_tick_forward();
+	void process_tick_backward();
+	
+	// Closed-form fast-forward/rewind by any number of ticks in O(units)
+	void advance_forward(int64_t ticks);
+	void advance_backward(int64_t ticks);
 	
 private:
+	struct UnitChange {
+		int unit = 0;
+		int new_value = 0;
+		int old_value = 0;
+	};
+
 	TimeUnitManager *unit_manager = nullptr;
-	Callable signal_callback;
+	TimeUnitState *state = nullptr;
+	bool reporting_changes = true;
+	Object *signal_target = nullptr;
+	StringName signal_name;
+	StringName batch_signal_name;
 	int current_tick = 0;
+	bool batch_changes = false;
+	bool deferring_changes = false;
+	uint32_t deferred_first = 0;
+	
+	// Per-tick scratch buffers, reused between ticks
+	LocalVector<int64_t> fire_counts;
+	// Complex units with at least one tracked unit fired during the current cascade
+	LocalVector<uint8_t> complex_pending;
+	// Units queued for the current cascade, bucketed by level: level i queues into
+	// [level_begin(i), level_begin(i) + frontier_counts[i]), a unit is queued at most once
+	LocalVector<int> frontier;
+	LocalVector<int> frontier_counts;
+	uint32_t frontier_size = 0;
+	LocalVector<UnitChange> changes;
+	// Current values of a complex unit's tracked units, gathered next to its thresholds
+	LocalVector<int> condition_operands;
+	uint32_t change_capacity = 0;
+	uint64_t allocation_count = 0;
+	
+	// Batch signal payload for one change count
+	struct BatchPayload {
+		PackedInt32Array units;
+		PackedInt32Array new_values;
+		PackedInt32Array old_values;
+	};
+	// Indexed by change count and kept between ticks, so a tick changing 1 unit and the next
+	// changing 2 don't resize the same arrays back and forth
+	LocalVector<BatchPayload> batch_payloads;
+	
+	// Helper methods (units are addressed by manager index, TICK_INDEX for "tick")
+	int64_t get_fire_count(int unit_index) const;
+	int64_t advance_simple_unit(int child, int64_t parent_fires);
+	int64_t rewind_simple_unit(int child, int64_t parent_fires);
+	int process_complex_unit(int child);
+	void mark_complex_dependents(int unit_index);
+	void queue_children(int unit_index);
+	void queue_unit(int unit_index);
 	
-	// Helper methods
-	void process_simple_unit_increment(const String &child_name, const String &parent_name);
-	void process_simple_unit_decrement(const String &child_name, const String &parent_name);
-	void process_complex_unit(const String &child_name, const String &parent_name);
+	// Set by the bulk paths, where "tick" fires more than once
+	int64_t tick_fires = 1;
 	
-	bool check_complex_conditions(const String &unit_name);
-	int apply_wrapping(int value, int min_val, int max_val);
-	void emit_change_signal(const String &name, int new_val, int old_val);
+	bool check_complex_conditions(int unit_index);
+	int64_t apply_wrapping(int64_t value, int min_val, int max_val, int64_t *r_wraps = nullptr);
+	int64_t apply_steps(int64_t value, int64_t fires, int64_t step, int min_val, int max_val, int64_t *r_wraps = nullptr);
+	uint32_t begin_cascade();
+	void record_change(int unit_index, int new_val, int old_val);
+	void flush_changes(uint32_t first);
+	void emit_batch_signal(uint32_t first);
+	int32_t *write_batch_array(PackedInt32Array &array);
+	void call_listeners(int unit_index, int new_val, int old_val);
 };
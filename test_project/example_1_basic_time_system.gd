@@ -63,7 +63,7 @@ func _ready() -> void:
 	time_tick.set_time_scale(200.0)
 
 
-func _on_time_unit_changed(unit_name: String, new_value: int, old_value: int) -> void:
+func _on_time_unit_changed(unit_name: StringName, new_value: int, old_value: int) -> void:
 	# Print formatted time every minute
 	if unit_name == "minute":
 		var formatted = time_tick.get_formatted_time_padded(["hour", "minute", "second"], ":")
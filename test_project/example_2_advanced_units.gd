@@ -68,7 +68,7 @@ func _ready() -> void:
 	time_tick.resume()
 
 
-func _on_time_unit_changed(unit_name: String, new_value: int, old_value: int) -> void:
+func _on_time_unit_changed(unit_name: StringName, new_value: int, old_value: int) -> void:
 	match unit_name:
 		"week":
 			print("\n📅 New Week! Week %d of Month %d\n" % [new_value, time_tick.get_time_unit("month")])
@@ -93,7 +93,7 @@ func _ready() -> void:
 	})
 
 
-func _on_time_unit_changed(unit_name: String, new_value: int, old_value: int) -> void:
+func _on_time_unit_changed(unit_name: StringName, new_value: int, old_value: int) -> void:
 	var hour = time_tick.get_time_unit("hour")
 	var minute = time_tick.get_time_unit("minute")
 	var second = time_tick.get_time_unit("second")